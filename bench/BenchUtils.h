@@ -0,0 +1,67 @@
+#ifndef MOD_PYTHON_ENGINE_BENCH_UTILS_H
+#define MOD_PYTHON_ENGINE_BENCH_UTILS_H
+
+#include "Define.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+namespace PyEng::Bench
+{
+    /**
+     * @brief Keeps the compiler from discarding a value computed by the benchmark
+     */
+    template<typename T>
+    inline void DoNotOptimize(T const& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static_cast<void>(*reinterpret_cast<char const volatile*>(&value));
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    /**
+     * @brief Forces pending memory writes, so loop iterations are not merged
+     */
+    inline void ClobberMemory()
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    /**
+     * @brief Times a benchmark body after a warm-up run
+     *
+     * @param iterations Timed calls of body (a tenth more are run as warm-up)
+     * @return Mean wall time of one call, in nanoseconds
+     */
+    template<typename Body>
+    double MeasureNs(uint64 iterations, Body&& body)
+    {
+        for (uint64 i = 0; i < iterations / 10; ++i)
+            body();
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint64 i = 0; i < iterations; ++i)
+            body();
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(iterations);
+    }
+
+    /**
+     * @brief Prints one result line
+     */
+    inline void Report(char const* name, double nanoseconds)
+    {
+        std::printf("%-52s %10.2f ns/call\n", name, nanoseconds);
+    }
+
+} // namespace PyEng::Bench
+
+#endif // MOD_PYTHON_ENGINE_BENCH_UTILS_H
@@ -0,0 +1,91 @@
+#include "BenchUtils.h"
+#include "PythonEngine.h"
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using PyEng::Bridge::API;
+
+namespace
+{
+    constexpr uint64 CALLS_PER_THREAD = 200000;
+
+    // Local work only: threads share the function, not the data
+    constexpr char const* CALLBACK_SOURCE = R"(
+def on_update(diff):
+    value = diff
+    for _ in range(32):
+        value = (value * 31 + 7) & 0xFFFF
+    return value
+)";
+
+    /**
+     * @brief Triggers the hook from every thread at once
+     *
+     * @return Dispatched callbacks per second, all threads together
+     */
+    double MeasureThroughput(uint32 threadCount)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back([] {
+                for (uint64 call = 0; call < CALLS_PER_THREAD; ++call)
+                    sPythonEngine->Trigger(PyEng::Hooks::World::ON_UPDATE, 0, static_cast<uint32>(call));
+            });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        double seconds = std::chrono::duration<double>(elapsed).count();
+        return static_cast<double>(CALLS_PER_THREAD) * threadCount / seconds;
+    }
+
+} // anonymous namespace
+
+/**
+ * @brief Hook dispatch throughput against the number of triggering threads
+ *
+ * Map update threads trigger hooks concurrently. With the GIL, callbacks
+ * are serialized and the throughput stays flat; a free-threaded build runs
+ * them in parallel and should scale with the thread count.
+ *
+ * Usage: pyeng-DispatchScalingBench [max threads] (default: hardware threads)
+ */
+int main(int argc, char* argv[])
+{
+    sPythonEngine->Initialize();
+
+    {
+        GILGuard gil;
+
+        API::Object globals = API::Import("__main__").attr("__dict__");
+        API::Exec(CALLBACK_SOURCE, globals, globals);
+        sPythonEngine->RegisterHook("WORLD_ON_UPDATE", globals["on_update"]);
+
+        std::printf("GIL enabled: %s\n", API::IsGILEnabled() ? "yes" : "no");
+    }
+
+    uint32 maxThreads = argc > 1 ? static_cast<uint32>(std::strtoul(argv[1], nullptr, 10))
+                                 : std::thread::hardware_concurrency();
+    maxThreads = std::max(1u, maxThreads);
+
+    double baseline = 0.0;
+    for (uint32 threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+    {
+        double throughput = MeasureThroughput(threadCount);
+        if (threadCount == 1)
+            baseline = throughput;
+
+        std::printf("%3u threads: %12.0f calls/s (x%.2f)\n", threadCount, throughput, throughput / baseline);
+    }
+
+    sPythonEngine->Shutdown();
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include "BenchUtils.h"
+#include "HookMacros.h"
+
+namespace
+{
+    constexpr uint64 ITERATIONS = 100000000;
+
+    uint32 evaluations = 0;
+
+    /**
+     * @brief Hook argument counting its evaluations
+     */
+    uint32 Argument()
+    {
+        ++evaluations;
+        return 1;
+    }
+
+} // anonymous namespace
+
+/**
+ * @brief Cost of a TRIGGER_* call site for a hook without subscribers
+ *
+ * Compares the macro, which tests the subscriber bitset before evaluating
+ * any argument, with a direct PythonEngine::Trigger call, which converts
+ * nothing either but reaches the registry snapshot first. No script is
+ * loaded, so no hook has subscribers.
+ */
+int main()
+{
+    using namespace PyEng::Bench;
+
+    sPythonEngine->Initialize();
+
+    double gated = MeasureNs(ITERATIONS, [] {
+        TRIGGER_WORLD_HOOK(ON_UPDATE, Argument());
+        ClobberMemory();
+    });
+    uint32 gatedEvaluations = evaluations;
+
+    double direct = MeasureNs(ITERATIONS / 10, [] {
+        sPythonEngine->Trigger(PyEng::Hooks::World::ON_UPDATE, 0, Argument());
+        ClobberMemory();
+    });
+
+    Report("TRIGGER_WORLD_HOOK, unsubscribed", gated);
+    Report("PythonEngine::Trigger, unsubscribed", direct);
+    std::printf("Arguments evaluated by the macro: %u\n", gatedEvaluations);
+    return gatedEvaluations == 0 ? 0 : 1;
+}
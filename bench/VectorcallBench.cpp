@@ -0,0 +1,70 @@
+#include "BenchUtils.h"
+#include "PythonAPI.h"
+#include <string>
+#include <utility>
+
+using PyEng::Bridge::API;
+
+namespace
+{
+    constexpr uint64 ITERATIONS = 2000000;
+
+    /**
+     * @brief Defines a Python function taking N positional arguments
+     */
+    template<std::size_t N>
+    API::Object DefineFunction(API::Object& globals)
+    {
+        std::string name = "f" + std::to_string(N);
+        std::string parameters;
+        for (std::size_t i = 0; i < N; ++i)
+            parameters += (i ? ", a" : "a") + std::to_string(i);
+
+        API::Exec("def " + name + "(" + parameters + "): pass", globals, globals);
+        return globals[name];
+    }
+
+    /**
+     * @brief Times the generic (tuple) and vectorcall paths with N int arguments
+     */
+    template<std::size_t N>
+    void Run(API::Object& globals)
+    {
+        using namespace PyEng::Bench;
+
+        API::Object function = DefineFunction<N>(globals);
+
+        std::array<API::Object, N> args;
+        for (API::Object& arg : args)
+            arg = API::Object(42);
+
+        double generic = MeasureNs(ITERATIONS, [&] { DoNotOptimize(API::Call(function, args).ptr()); });
+        double vectorcall = MeasureNs(ITERATIONS, [&] { DoNotOptimize(API::Vectorcall(function, args).ptr()); });
+
+        std::printf("%zu args: generic %8.1f ns, vectorcall %8.1f ns\n", N, generic, vectorcall);
+    }
+
+    template<std::size_t... N>
+    void RunAll(API::Object& globals, std::index_sequence<N...>)
+    {
+        (Run<N>(globals), ...);
+    }
+
+} // anonymous namespace
+
+/**
+ * @brief Cost of one callback invocation, generic call versus vectorcall
+ *
+ * Calls a pure Python function with 0 to 8 int arguments, the range of
+ * hook signatures, through API::Call (argument tuple built per call) and
+ * API::Vectorcall (borrowed stack array).
+ */
+int main()
+{
+    Py_Initialize();
+
+    API::Object globals = API::Import("__main__").attr("__dict__");
+    RunAll(globals, std::make_index_sequence<9>{});
+
+    return 0;
+}
@@ -5,6 +5,41 @@ find_package(Python3 3.10 COMPONENTS Interpreter Development REQUIRED)
 set(BOOST_PYTHON_COMPONENT "python${Python3_VERSION_MAJOR}${Python3_VERSION_MINOR}")
 find_package(Boost REQUIRED COMPONENTS ${BOOST_PYTHON_COMPONENT})
 
+# Free-threaded CPython (3.13t and later): no GIL, hooks fired from different
+# map threads run Python in parallel. Boost.Python must be built against it
+execute_process(
+  COMMAND ${Python3_EXECUTABLE} -c
+    "import sysconfig; print(sysconfig.get_config_var('Py_GIL_DISABLED') or 0, sysconfig.get_config_var('LIBDIR') or '')"
+  OUTPUT_VARIABLE PYENG_PYTHON_CONFIG
+  OUTPUT_STRIP_TRAILING_WHITESPACE
+  ERROR_QUIET
+)
+separate_arguments(PYENG_PYTHON_CONFIG)
+list(GET PYENG_PYTHON_CONFIG 0 PYENG_PYTHON_GIL_DISABLED)
+
+set(PYENG_PYTHON_LIBRARIES ${Python3_LIBRARIES})
+if(PYENG_PYTHON_GIL_DISABLED STREQUAL "1")
+  message(WARNING "Free-threaded Python ${Python3_VERSION} detected, the GIL is disabled. "
+                  "This support is experimental and untested")
+
+  # FindPython may pick the default ABI library (libpython3.13 instead of libpython3.13t)
+  list(LENGTH PYENG_PYTHON_CONFIG PYENG_PYTHON_CONFIG_LENGTH)
+  if(PYENG_PYTHON_CONFIG_LENGTH GREATER 1)
+    list(GET PYENG_PYTHON_CONFIG 1 PYENG_PYTHON_LIBDIR)
+  endif()
+  find_library(PYENG_PYTHON_FREE_THREADED_LIBRARY
+    NAMES
+      python${Python3_VERSION_MAJOR}.${Python3_VERSION_MINOR}t
+      python${Python3_VERSION_MAJOR}${Python3_VERSION_MINOR}t
+    HINTS ${PYENG_PYTHON_LIBDIR} ${Python3_LIBRARY_DIRS}
+  )
+  if(PYENG_PYTHON_FREE_THREADED_LIBRARY)
+    set(PYENG_PYTHON_LIBRARIES ${PYENG_PYTHON_FREE_THREADED_LIBRARY})
+  else()
+    message(WARNING "Free-threaded Python library not found, linking ${Python3_LIBRARIES}")
+  endif()
+endif()
+
 # Create an interface library for Python/Boost
 add_library(pyeng-interface INTERFACE)
 target_include_directories(pyeng-interface
@@ -14,10 +49,15 @@ target_include_directories(pyeng-interface
 )
 target_link_libraries(pyeng-interface
   INTERFACE
-    ${Python3_LIBRARIES}
+    ${PYENG_PYTHON_LIBRARIES}
     ${Boost_LIBRARIES}
 )
 
+# pyconfig.h only defines it on POSIX, Windows shares the header between both builds
+if(PYENG_PYTHON_GIL_DISABLED STREQUAL "1")
+  target_compile_definitions(pyeng-interface INTERFACE Py_GIL_DISABLED=1)
+endif()
+
 # Apply Python/Boost to main modules target
 target_link_libraries(modules PRIVATE pyeng-interface)
 
@@ -39,3 +79,57 @@ endif()
 
 # Boost.Python and modern Python C API require at least C++17
 target_compile_features(modules PRIVATE cxx_std_17)
+
+# Unit tests, built with the core's BUILD_TESTING option and run by ctest
+if(BUILD_TESTING AND TARGET gtest_main)
+  file(GLOB PYENG_TEST_SOURCES CONFIGURE_DEPENDS "${CMAKE_CURRENT_LIST_DIR}/tests/*.cpp")
+
+  add_executable(pyeng-tests ${PYENG_TEST_SOURCES})
+  target_include_directories(pyeng-tests
+    PRIVATE
+      ${CMAKE_CURRENT_LIST_DIR}/src
+      ${CMAKE_CURRENT_LIST_DIR}/src/Bridge
+      ${CMAKE_CURRENT_LIST_DIR}/src/Hooks
+      ${CMAKE_CURRENT_LIST_DIR}/src/Utilities
+      ${CMAKE_CURRENT_LIST_DIR}/src/Bindings
+      ${CMAKE_CURRENT_LIST_DIR}/src/Bindings/Handles
+  )
+  target_link_libraries(pyeng-tests PRIVATE modules game gtest_main pyeng-interface)
+  target_compile_features(pyeng-tests PRIVATE cxx_std_17)
+  if(MSVC)
+    target_compile_options(pyeng-tests PRIVATE "/GR" "/EHsc")
+  elseif(CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+    target_compile_options(pyeng-tests PRIVATE "-frtti")
+  endif()
+
+  include(GoogleTest)
+  gtest_discover_tests(pyeng-tests)
+endif()
+
+# Microbenchmarks (bench/), one executable per source, run by hand
+option(PYTHON_ENGINE_BUILD_BENCHMARKS "Build the mod-python-engine microbenchmarks" OFF)
+if(PYTHON_ENGINE_BUILD_BENCHMARKS)
+  file(GLOB PYENG_BENCH_SOURCES CONFIGURE_DEPENDS "${CMAKE_CURRENT_LIST_DIR}/bench/*.cpp")
+
+  foreach(PYENG_BENCH_SOURCE ${PYENG_BENCH_SOURCES})
+    get_filename_component(PYENG_BENCH_NAME ${PYENG_BENCH_SOURCE} NAME_WE)
+    set(PYENG_BENCH_TARGET "pyeng-${PYENG_BENCH_NAME}")
+
+    add_executable(${PYENG_BENCH_TARGET} ${PYENG_BENCH_SOURCE})
+    target_include_directories(${PYENG_BENCH_TARGET}
+      PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/bench
+        ${CMAKE_CURRENT_LIST_DIR}/src
+        ${CMAKE_CURRENT_LIST_DIR}/src/Bridge
+        ${CMAKE_CURRENT_LIST_DIR}/src/Hooks
+        ${CMAKE_CURRENT_LIST_DIR}/src/Utilities
+    )
+    target_link_libraries(${PYENG_BENCH_TARGET} PRIVATE modules game pyeng-interface)
+    target_compile_features(${PYENG_BENCH_TARGET} PRIVATE cxx_std_17)
+    if(MSVC)
+      target_compile_options(${PYENG_BENCH_TARGET} PRIVATE "/GR" "/EHsc")
+    elseif(CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+      target_compile_options(${PYENG_BENCH_TARGET} PRIVATE "-frtti")
+    endif()
+  endforeach()
+endif()
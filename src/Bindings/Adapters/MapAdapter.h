@@ -2,11 +2,45 @@
 #define MOD_PYTHON_ENGINE_MAP_ADAPTER_H
 
 #include "Map.h"
+#include "MapHandle.h"
+#include "PythonConverter.h"
 
-namespace PyEng::Mapdapter
+namespace PyEng::MapAdapter
 {
-    // @todo
+    /**
+     * @brief Forwards a Map member function through a MapHandle
+     *
+     * Invoke() resolves the map first and returns None if it is unloaded.
+     *
+     * @tparam Method Const member function of Map
+     */
+    template<auto Method>
+    struct Call;
 
-} // namespace PyEng::Mapdapter
+    template<typename R, typename... Params, R (Map::*Method)(Params...) const>
+    struct Call<Method>
+    {
+        static Bridge::API::Object Invoke(MapHandle const& handle, Params... params)
+        {
+            Map* map = handle.Find();
+            return map ? Bridge::Converter::ToPython((map->*Method)(params...)) : Bridge::API::Object();
+        }
+    };
+
+    // Lookups go through the proxy cache, so objects found on the map keep
+    // the same Python identity as the ones passed to hooks
+    inline Bridge::API::Object GetCreature(MapHandle const& handle, ObjectGuid const& guid)
+    {
+        Map* map = handle.Find();
+        return map ? Bridge::Converter::ToPython(map->GetCreature(guid)) : Bridge::API::Object();
+    }
+
+    inline Bridge::API::Object GetGameObject(MapHandle const& handle, ObjectGuid const& guid)
+    {
+        Map* map = handle.Find();
+        return map ? Bridge::Converter::ToPython(map->GetGameObject(guid)) : Bridge::API::Object();
+    }
+
+} // namespace PyEng::MapAdapter
 
 #endif // MOD_PYTHON_ENGINE_MAP_ADAPTER_H
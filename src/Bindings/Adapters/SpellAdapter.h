@@ -0,0 +1,34 @@
+#ifndef MOD_PYTHON_ENGINE_SPELL_ADAPTER_H
+#define MOD_PYTHON_ENGINE_SPELL_ADAPTER_H
+
+#include "Spell.h"
+#include "SpellAuras.h"
+#include "PythonConverter.h"
+
+namespace PyEng::SpellAdapter
+{
+    // World object targets go through the proxy cache (same identity as hook
+    // arguments, neutered once the target leaves the world)
+    inline Bridge::API::Object GetUnitTarget(SpellCastTargets* targets)
+    {
+        return targets ? Bridge::Converter::ToPython(targets->GetUnitTarget()) : Bridge::API::Object();
+    }
+
+    inline Bridge::API::Object GetObjectTarget(SpellCastTargets* targets)
+    {
+        return targets ? Bridge::Converter::ToPython(targets->GetObjectTarget()) : Bridge::API::Object();
+    }
+
+    inline Bridge::API::Object GetAuraCaster(Aura* aura)
+    {
+        return aura ? Bridge::Converter::ToPython(aura->GetCaster()) : Bridge::API::Object();
+    }
+
+    inline Bridge::API::Object GetAuraOwner(Aura* aura)
+    {
+        return aura ? Bridge::Converter::ToPython(aura->GetOwner()) : Bridge::API::Object();
+    }
+
+} // namespace PyEng::SpellAdapter
+
+#endif // MOD_PYTHON_ENGINE_SPELL_ADAPTER_H
@@ -1,5 +1,6 @@
 #include "PythonHeaders.h"
 #include "SharedDefines.h"
+#include "SpellAuraDefines.h"
 
 namespace bp = boost::python;
 
@@ -73,4 +74,14 @@ void export_game_constants()
         .value("Artifact",      ITEM_QUALITY_ARTIFACT)  // 6
         .value("Heirloom",      ITEM_QUALITY_HEIRLOOM)  // 7
         .export_values();
+
+    // enum AuraRemoveMode
+    bp::enum_<AuraRemoveMode>("AuraRemoveMode")
+        .value("ByDefault",     AURA_REMOVE_BY_DEFAULT)         // 1
+        .value("ByInterrupt",   AURA_REMOVE_BY_INTERRUPT)       // 2
+        .value("ByCancel",      AURA_REMOVE_BY_CANCEL)          // 3
+        .value("ByEnemySpell",  AURA_REMOVE_BY_ENEMY_SPELL)     // 4
+        .value("ByExpire",      AURA_REMOVE_BY_EXPIRE)          // 5
+        .value("ByDeath",       AURA_REMOVE_BY_DEATH)           // 6
+        .export_values();
 }
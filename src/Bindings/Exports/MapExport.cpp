@@ -3,39 +3,52 @@
 #include "Player.h"
 #include "Creature.h"
 #include "GameObject.h"
+#include "MapAdapter.h"
 
 namespace bp = boost::python;
 
 /**
- * @brief Map Class - Represents a game map (world, dungeon, battleground, etc.)
+ * @brief Map Class - Handle to a game map (world, dungeon, battleground, etc.)
+ * @note Looked up again on every call, methods return None once the map is unloaded
  */
 void export_map_class()
 {
-    bp::class_<Map, boost::noncopyable> map_class("Map", bp::no_init);
+    using PyEng::MapHandle;
+    using PyEng::MapAdapter::Call;
+
+    bp::class_<MapHandle> map_class("Map", bp::no_init);
 
     // common
-    map_class.def("GetId", &Map::GetId);
-    map_class.def("GetMapName", &Map::GetMapName);
+    map_class.def("GetId", &MapHandle::GetId);
+    map_class.def("GetInstanceId", &MapHandle::GetInstanceId);
+    map_class.def("GetMapName", &Call<&Map::GetMapName>::Invoke);
+    map_class.def("IsValid", &MapHandle::IsValid);
 
     // type checks
-    map_class.def("Instanceable", &Map::Instanceable);
-    map_class.def("IsDungeon", &Map::IsDungeon);
-    map_class.def("IsNonRaidDungeon", &Map::IsNonRaidDungeon);
-    map_class.def("IsRaid", &Map::IsRaid);
-    map_class.def("IsRaidOrHeroicDungeon", &Map::IsRaidOrHeroicDungeon);
-    map_class.def("IsHeroic", &Map::IsHeroic);
-    map_class.def("Is25ManRaid", &Map::Is25ManRaid);
-    map_class.def("IsBattleground", &Map::IsBattleground);
-    map_class.def("IsBattleArena", &Map::IsBattleArena);
-    map_class.def("IsBattlegroundOrArena", &Map::IsBattlegroundOrArena);
-    map_class.def("IsWorldMap", &Map::IsWorldMap);
+    map_class.def("Instanceable", &Call<&Map::Instanceable>::Invoke);
+    map_class.def("IsDungeon", &Call<&Map::IsDungeon>::Invoke);
+    map_class.def("IsNonRaidDungeon", &Call<&Map::IsNonRaidDungeon>::Invoke);
+    map_class.def("IsRaid", &Call<&Map::IsRaid>::Invoke);
+    map_class.def("IsRaidOrHeroicDungeon", &Call<&Map::IsRaidOrHeroicDungeon>::Invoke);
+    map_class.def("IsHeroic", &Call<&Map::IsHeroic>::Invoke);
+    map_class.def("Is25ManRaid", &Call<&Map::Is25ManRaid>::Invoke);
+    map_class.def("IsBattleground", &Call<&Map::IsBattleground>::Invoke);
+    map_class.def("IsBattleArena", &Call<&Map::IsBattleArena>::Invoke);
+    map_class.def("IsBattlegroundOrArena", &Call<&Map::IsBattlegroundOrArena>::Invoke);
+    map_class.def("IsWorldMap", &Call<&Map::IsWorldMap>::Invoke);
 
     // entity
-    map_class.def("GetCreature", &Map::GetCreature, bp::return_value_policy<bp::reference_existing_object>());
-    map_class.def("GetGameObject", &Map::GetGameObject, bp::return_value_policy<bp::reference_existing_object>());
+    map_class.def("GetCreature", &PyEng::MapAdapter::GetCreature);
+    map_class.def("GetGameObject", &PyEng::MapAdapter::GetGameObject);
 
     // location
-    map_class.def("GetHeight", static_cast<float (Map::*)(float, float, float, bool, float) const>(&Map::GetHeight));
-    map_class.def("GetAreaId", &Map::GetAreaId);
-    map_class.def("GetZoneId", &Map::GetZoneId);
+    map_class.def("GetHeight",
+                  &Call<static_cast<float (Map::*)(float, float, float, bool, float) const>(&Map::GetHeight)>::Invoke);
+    map_class.def("GetAreaId", &Call<&Map::GetAreaId>::Invoke);
+    map_class.def("GetZoneId", &Call<&Map::GetZoneId>::Invoke);
+
+    // comparison
+    map_class.def(bp::self == bp::self);
+    map_class.def(bp::self != bp::self);
+    map_class.def("__hash__", &MapHandle::GetHash);
 }
@@ -1,5 +1,7 @@
 #include "PythonHeaders.h"
 #include "Object.h"
+#include "MapHandle.h"
+#include "ObjectHandle.h"
 
 namespace bp = boost::python;
 
@@ -53,5 +55,8 @@ void export_worldobject_class()
     worldobject_class.def("GetInstanceId", &WorldObject::GetInstanceId);
     worldobject_class.def("GetAreaId", &WorldObject::GetAreaId);
     worldobject_class.def("GetZoneId", &WorldObject::GetZoneId);
-    worldobject_class.def("GetMap", &WorldObject::GetMap, bp::return_value_policy<bp::reference_existing_object>());
+    worldobject_class.def("GetMap", &PyEng::GetMapHandle);
+
+    // handle
+    worldobject_class.def("GetHandle", &PyEng::MakeHandle);
 }
@@ -0,0 +1,58 @@
+#include "PythonHeaders.h"
+#include "ObjectHandle.h"
+
+namespace bp = boost::python;
+
+namespace
+{
+    /**
+     * @brief Converts world objects captured for async hooks to handles
+     */
+    struct DeferredObjectToHandle
+    {
+        static PyObject* convert(PyEng::Hooks::DeferredObject const& object)
+        {
+            return bp::incref(bp::object(PyEng::ObjectHandle(object)).ptr());
+        }
+    };
+
+    /**
+     * @brief Hashes the GUID, consistent with == (handles compare by GUID)
+     */
+    uint64 HashHandle(PyEng::ObjectHandle const& handle)
+    {
+        return handle.GetGUID().GetRawValue();
+    }
+
+} // anonymous namespace
+
+/**
+ * @brief ObjectHandle Class - GUID-backed reference safe to keep across ticks
+ */
+void export_objecthandle_class()
+{
+    using PyEng::ObjectHandle;
+
+    bp::class_<ObjectHandle> objecthandle_class("ObjectHandle");
+
+    // constructor
+    objecthandle_class.def(bp::init<>());
+
+    // common
+    objecthandle_class.def("GetGUID", &ObjectHandle::GetGUID);
+    objecthandle_class.def("GetMapId", &ObjectHandle::GetMapId);
+    objecthandle_class.def("GetInstanceId", &ObjectHandle::GetInstanceId);
+    objecthandle_class.def("IsEmpty", &ObjectHandle::IsEmpty);
+
+    // resolution
+    objecthandle_class.def("Resolve", &ObjectHandle::Resolve);
+    objecthandle_class.def("IsValid", &ObjectHandle::IsValid);
+
+    // comparison
+    objecthandle_class.def(bp::self == bp::self);
+    objecthandle_class.def(bp::self != bp::self);
+    objecthandle_class.def("__hash__", &HashHandle);
+
+    // async hook arguments
+    bp::to_python_converter<PyEng::Hooks::DeferredObject, DeferredObjectToHandle>();
+}
@@ -1,8 +1,10 @@
 #include "PythonHeaders.h"
 #include "SpellInfo.h"
 #include "Spell.h"
+#include "SpellAuras.h"
 #include "Corpse.h"
 #include "Item.h"
+#include "SpellAdapter.h"
 
 namespace bp = boost::python;
 
@@ -47,10 +49,11 @@ void export_spellcast_targets_class()
     bp::class_<SpellCastTargets> spellcast_targets_class("SpellCastTargets", bp::no_init);
 
     // target ref
-    spellcast_targets_class.def("GetUnitTarget", &SpellCastTargets::GetUnitTarget,
-                                bp::return_value_policy<bp::reference_existing_object>());
-    spellcast_targets_class.def("GetObjectTarget", &SpellCastTargets::GetObjectTarget,
-                                bp::return_value_policy<bp::reference_existing_object>());
+    spellcast_targets_class.def("GetUnitTarget", &PyEng::SpellAdapter::GetUnitTarget);
+    spellcast_targets_class.def("GetObjectTarget", &PyEng::SpellAdapter::GetObjectTarget);
+
+    // NOTE: Items and corpses are not tracked by the proxy cache, these are
+    // valid during the hook call only (keep the GUID instead)
     spellcast_targets_class.def("GetCorpseTarget", &SpellCastTargets::GetCorpseTarget,
                                 bp::return_value_policy<bp::reference_existing_object>());
     spellcast_targets_class.def("GetItemTarget", &SpellCastTargets::GetItemTarget,
@@ -62,3 +65,29 @@ void export_spellcast_targets_class()
     spellcast_targets_class.def("GetCorpseTargetGUID", &SpellCastTargets::GetCorpseTargetGUID);
     spellcast_targets_class.def("GetItemTargetGUID", &SpellCastTargets::GetItemTargetGUID);
 }
+
+/**
+ * @brief Aura Class - Spell aura applied to a unit (valid during the hook call only)
+ */
+void export_aura_class()
+{
+    bp::class_<Aura, boost::noncopyable> aura_class("Aura", bp::no_init);
+
+    // spell
+    aura_class.def("GetId", &Aura::GetId);
+    aura_class.def("GetSpellInfo", &Aura::GetSpellInfo, bp::return_value_policy<bp::reference_existing_object>());
+
+    // caster and owner
+    aura_class.def("GetCaster", &PyEng::SpellAdapter::GetAuraCaster);
+    aura_class.def("GetCasterGUID", &Aura::GetCasterGUID);
+    aura_class.def("GetOwner", &PyEng::SpellAdapter::GetAuraOwner);
+
+    // state
+    aura_class.def("GetDuration", &Aura::GetDuration);
+    aura_class.def("GetMaxDuration", &Aura::GetMaxDuration);
+    aura_class.def("GetStackAmount", &Aura::GetStackAmount);
+    aura_class.def("GetCharges", &Aura::GetCharges);
+    aura_class.def("IsPassive", &Aura::IsPassive);
+    aura_class.def("IsPermanent", &Aura::IsPermanent);
+    aura_class.def("IsRemoved", &Aura::IsRemoved);
+}
@@ -1,38 +1,330 @@
 #include "PythonEngine.h"
 #include "PythonAPI.h"
+#include "PythonEvent.h"
+#include "PythonAwaitable.h"
+#include "HookEntry.h"
+#include "HookStubs.h"
+#include <vector>
 
 namespace bp = boost::python;
 using namespace PyEng::Bridge;
 
 namespace
 {
+    using PyEng::Hooks::CallbackFilter;
+
+    /**
+     * @brief Sets a filter field from an optional id (None = any)
+     */
+    void SetFilterField(CallbackFilter& filter, CallbackFilter::Field field, uint32& id, API::Object const& value)
+    {
+        if (value.is_none())
+            return;
+
+        // Raises TypeError/OverflowError for anything but a uint32
+        id = bp::extract<uint32>(value);
+        filter.mask |= field;
+    }
+
+    // pow() without modulo, for the binary number protocol of MutableValue
+    PyObject* PowerOf(PyObject* base, PyObject* exponent)
+    {
+        return PyNumber_Power(base, exponent, Py_None);
+    }
+
+    /**
+     * @brief Raises ValueError with the message (Python exception)
+     */
+    void RaiseValueError(std::string const& message)
+    {
+        PyErr_SetString(PyExc_ValueError, message.c_str());
+        bp::throw_error_already_set();
+    }
+
     /**
-     * @brief Register global hook (no entry ID)
+     * @brief Rejects callbacks handed over by a sub-interpreter
      *
-     * @param eventName Hook name string (ex., "PLAYER_ON_LOGIN")
-     * @param callback Python callable object
+     * Hooks, timers and batches are run in the main interpreter (GILGuard
+     * uses PyGILState), where objects of another interpreter must not be used.
      */
-    void RegisterGlobal(char const* eventName, API::Object callback)
+    void RequireMainInterpreter()
     {
-        if (!sPythonEngine->IsEnabled())
+        if (PyInterpreterState_Get() == PyInterpreterState_Main())
             return;
 
-        sPythonEngine->RegisterHook(std::string(eventName), callback, 0);
+        PyErr_SetString(PyExc_RuntimeError, "callbacks can only be registered from the main interpreter");
+        bp::throw_error_already_set();
+    }
+
+    /**
+     * @brief Converts a level filter value (0-255)
+     */
+    uint8 ToLevel(API::Object const& value)
+    {
+        uint32 level = bp::extract<uint32>(value);
+        if (level > 255)
+            RaiseValueError("level filter out of range [0, 255]");
+
+        return static_cast<uint8>(level);
     }
 
     /**
-     * @brief Register entry-specific hook
+     * @brief Converts one id or a sequence of ids (class, race) to a bit mask
+     */
+    uint32 ToIdMask(API::Object const& value)
+    {
+        std::vector<uint32> ids;
+
+        bp::extract<uint32> single(value);
+        if (single.check())
+            ids.push_back(single());
+        else
+            ids.assign(bp::stl_input_iterator<uint32>(value), bp::stl_input_iterator<uint32>());
+
+        uint32 mask = 0;
+        for (uint32 id : ids)
+        {
+            if (id >= 32)
+                RaiseValueError("class/race filter id out of range [0, 31]");
+
+            mask |= 1u << id;
+        }
+
+        return mask;
+    }
+
+    /**
+     * @brief Adds the fields of a filter dict to the filter
+     *
+     * Keys: min_level, max_level, class, race (id or sequence of ids),
+     * team (0 = Alliance, 1 = Horde), in_combat, gm (bool).
+     */
+    void ParseFilter(CallbackFilter& filter, API::Object const& fields)
+    {
+        if (fields.is_none())
+            return;
+
+        if (!PyDict_Check(fields.ptr()))
+        {
+            PyErr_SetString(PyExc_TypeError, "filter must be a dict");
+            bp::throw_error_already_set();
+        }
+
+        bp::list items = bp::dict(fields).items();
+        for (bp::ssize_t i = 0, size = bp::len(items); i < size; ++i)
+        {
+            std::string key = bp::extract<std::string>(items[i][0]);
+            API::Object value = items[i][1];
+
+            if (key == "min_level")
+            {
+                filter.minLevel = ToLevel(value);
+                filter.mask |= CallbackFilter::FIELD_LEVEL;
+            }
+            else if (key == "max_level")
+            {
+                filter.maxLevel = ToLevel(value);
+                filter.mask |= CallbackFilter::FIELD_LEVEL;
+            }
+            else if (key == "class")
+            {
+                filter.classMask = ToIdMask(value);
+                filter.mask |= CallbackFilter::FIELD_CLASS;
+            }
+            else if (key == "race")
+            {
+                filter.raceMask = ToIdMask(value);
+                filter.mask |= CallbackFilter::FIELD_RACE;
+            }
+            else if (key == "team")
+            {
+                uint32 team = bp::extract<uint32>(value);
+                if (team > 1)
+                    RaiseValueError("team filter must be 0 (Alliance) or 1 (Horde)");
+
+                filter.teamId = static_cast<uint8>(team);
+                filter.mask |= CallbackFilter::FIELD_TEAM;
+            }
+            else if (key == "in_combat")
+            {
+                filter.inCombat = bp::extract<bool>(value);
+                filter.mask |= CallbackFilter::FIELD_COMBAT;
+            }
+            else if (key == "gm")
+            {
+                filter.gameMaster = bp::extract<bool>(value);
+                filter.mask |= CallbackFilter::FIELD_GM;
+            }
+            else
+                RaiseValueError("unknown filter field '" + key + "'");
+        }
+    }
+
+    /**
+     * @brief Register hook callback
      *
      * @param eventName Hook name string (ex., "CREATURE_ON_GOSSIP_HELLO")
      * @param callback Python callable object
-     * @param entryId Specific entry ID (creature/item/spell/etc.)
+     * @param entryId Specific entry ID (creature/item/spell/opcode; 0 = global)
+     * @param flags HookFlag bits (ex., HookFlag.Async)
+     * @param map Map id the player must be on (None = any)
+     * @param zone Zone id the player must be in (None = any)
+     * @param area Area id the player must be in (None = any)
+     * @param filter Dict of player guards (ex., {"min_level": 80, "in_combat": False}), or None
+     * @param interval Minimum time between calls per object in milliseconds (per-tick hooks; 0 = every tick)
      */
-    void RegisterEntry(char const* eventName, API::Object callback, uint32 entryId)
+    void Register(char const* eventName, API::Object callback, uint32 entryId, uint32 flags, API::Object map,
+                  API::Object zone, API::Object area, API::Object filter, uint32 interval)
     {
         if (!sPythonEngine->IsEnabled())
             return;
 
-        sPythonEngine->RegisterHook(std::string(eventName), callback, entryId);
+        RequireMainInterpreter();
+
+        CallbackFilter callbackFilter;
+        SetFilterField(callbackFilter, CallbackFilter::FIELD_MAP, callbackFilter.mapId, map);
+        SetFilterField(callbackFilter, CallbackFilter::FIELD_ZONE, callbackFilter.zoneId, zone);
+        SetFilterField(callbackFilter, CallbackFilter::FIELD_AREA, callbackFilter.areaId, area);
+        ParseFilter(callbackFilter, filter);
+
+        sPythonEngine->RegisterHook(std::string(eventName), callback, entryId, flags, callbackFilter, interval);
+    }
+
+    /**
+     * @brief Register batch hook callback
+     *
+     * @param eventName Hook name string (ex., "UNIT_ON_DAMAGE")
+     * @param callback Python callable taking (sources, targets, amounts, spells, times) memoryviews
+     * @param interval Delivery interval in milliseconds
+     */
+    void RegisterBatch(char const* eventName, API::Object callback, uint32 interval)
+    {
+        if (!sPythonEngine->IsEnabled())
+            return;
+
+        RequireMainInterpreter();
+
+        sPythonEngine->RegisterBatch(std::string(eventName), callback, interval);
+    }
+
+    /**
+     * @brief Schedule a callback once
+     *
+     * @param delay Time until the call in milliseconds
+     * @param callback Python callable taking no arguments
+     * @return Timer handle for Cancel, 0 if the callback was rejected
+     */
+    uint64 Schedule(uint32 delay, API::Object callback)
+    {
+        if (!sPythonEngine->IsEnabled())
+            return 0;
+
+        RequireMainInterpreter();
+
+        return sPythonEngine->ScheduleTimer(callback, delay);
+    }
+
+    /**
+     * @brief Schedule a callback every interval
+     *
+     * @param interval Time between calls in milliseconds (first call after one interval)
+     * @param callback Python callable taking no arguments
+     * @return Timer handle for Cancel, 0 if the callback was rejected
+     */
+    uint64 ScheduleRepeating(uint32 interval, API::Object callback)
+    {
+        if (!sPythonEngine->IsEnabled())
+            return 0;
+
+        RequireMainInterpreter();
+
+        if (!interval)
+        {
+            LOG_ERROR("module.python", "Attempted to schedule a repeating timer with a zero interval.");
+            return 0;
+        }
+
+        return sPythonEngine->ScheduleTimer(callback, interval, interval);
+    }
+
+    /**
+     * @brief Cancel a scheduled callback
+     *
+     * @param handle Handle returned by Schedule or ScheduleRepeating
+     * @return True if the timer was pending
+     */
+    bool Cancel(uint64 handle)
+    {
+        if (!sPythonEngine->IsEnabled())
+            return false;
+
+        return sPythonEngine->CancelTimer(handle);
+    }
+
+    /**
+     * @brief Awaitable suspending a coroutine callback
+     *
+     * @param delay Time until the coroutine is resumed in milliseconds
+     * @return Awaitable evaluating to None
+     */
+    API::Object Sleep(uint32 delay)
+    {
+        return API::Object(std::make_shared<Awaitable>(Awaitable::Kind::Sleep, delay));
+    }
+
+    /**
+     * @brief Awaitable suspending a coroutine callback until a hook is raised
+     *
+     * @param eventName Hook name string (ex., "PLAYER_ON_LOGOUT")
+     * @param entryId Specific entry ID (creature/item/spell/opcode; 0 = any)
+     * @param timeout Maximum wait in milliseconds (0 = none)
+     * @return Awaitable evaluating to True once the hook was raised, False on timeout
+     */
+    API::Object WaitFor(std::string const& eventName, uint32 entryId, uint32 timeout)
+    {
+        auto const* description = PyEng::Hooks::FindHookDescription(eventName);
+        if (!description)
+            RaiseValueError("unknown event hook '" + eventName + "'");
+
+        if (entryId && PyEng::Hooks::GetEntryKind(description->info) == PyEng::Hooks::EntryKind::None)
+            RaiseValueError("event hook '" + eventName + "' is global, it has no entry");
+
+        return API::Object(
+            std::make_shared<Awaitable>(Awaitable::Kind::Event, timeout, description->info, entryId));
+    }
+
+    /**
+     * @brief Get declared arguments of a hook
+     *
+     * @param eventName Hook name string (ex., "PLAYER_ON_LOGIN")
+     * @return List of (name, type) tuples, or None if the hook is unknown or
+     *         declared without arguments
+     */
+    API::Object GetHookSignature(char const* eventName)
+    {
+        auto const* description = PyEng::Hooks::FindHookDescription(eventName);
+        if (!description || !description->typed)
+            return API::Object();
+
+        bp::list signature;
+        for (std::size_t i = 0; i < description->arity; ++i)
+        {
+            auto const& parameter = description->parameters[i];
+            signature.append(bp::make_tuple(std::string(parameter.name),
+                                            PyEng::Hooks::ToPythonTypeName(parameter.type)));
+        }
+
+        return signature;
+    }
+
+    /**
+     * @brief Generate .pyi overloads of Register for all typed hooks
+     *
+     * @return Stub source text
+     */
+    std::string GenerateHookStubs()
+    {
+        return PyEng::Hooks::GenerateHookStubs();
     }
 
 } // anonymous namespace
@@ -42,9 +334,111 @@ namespace
  */
 void export_hook_api()
 {
-    // Usage: azerothcore.Register("PLAYER_ON_LOGIN", on_login)
-    bp::def("Register", &RegisterGlobal);
+    // enum HookFlag
+    bp::enum_<PyEng::Hooks::HookFlag>("HookFlag")
+        .value("Async",         PyEng::Hooks::HOOK_FLAG_ASYNC)  // 0x01
+        .value("Lazy",          PyEng::Hooks::HOOK_FLAG_LAZY)   // 0x04
+        .export_values();
+
+    // Event passed to lazy callbacks, valid during its dispatch only
+    // Usage: def on_give_exp(event): print(event.player, event.amount)
+    bp::class_<HookEvent, std::shared_ptr<HookEvent>, boost::noncopyable>("HookEvent", bp::no_init)
+        .def("__getattr__", &HookEvent::GetAttribute)
+        .def("__repr__", &HookEvent::GetRepr);
 
+    // By-reference number argument, written back after the dispatch
+    // Usage: def on_give_exp(player, amount, victim, source): amount.value *= 2
+    // Also usable as the number itself: if amount > 1000: ...
+    bp::class_<MutableValue, std::shared_ptr<MutableValue>, boost::noncopyable>("MutableValue", bp::no_init)
+        .add_property("value", &MutableValue::GetValue, &MutableValue::SetValue)
+        .def("__repr__", &MutableValue::GetRepr)
+        .def("__str__", &MutableValue::GetString)
+        .def("__format__", &MutableValue::Format)
+        .def("__bool__", &MutableValue::IsTrue)
+        .def("__int__", &MutableValue::Apply<PyNumber_Long>)
+        .def("__index__", &MutableValue::Apply<PyNumber_Index>)
+        .def("__float__", &MutableValue::Apply<PyNumber_Float>)
+        .def("__round__", &MutableValue::Round, (bp::arg("ndigits") = API::Object()))
+        .def("__neg__", &MutableValue::Apply<PyNumber_Negative>)
+        .def("__pos__", &MutableValue::Apply<PyNumber_Positive>)
+        .def("__abs__", &MutableValue::Apply<PyNumber_Absolute>)
+        .def("__invert__", &MutableValue::Apply<PyNumber_Invert>)
+        .def("__eq__", &MutableValue::Compare<Py_EQ>)
+        .def("__ne__", &MutableValue::Compare<Py_NE>)
+        .def("__lt__", &MutableValue::Compare<Py_LT>)
+        .def("__le__", &MutableValue::Compare<Py_LE>)
+        .def("__gt__", &MutableValue::Compare<Py_GT>)
+        .def("__ge__", &MutableValue::Compare<Py_GE>)
+        .def("__add__", &MutableValue::Apply<PyNumber_Add>)
+        .def("__radd__", &MutableValue::ApplyReflected<PyNumber_Add>)
+        .def("__sub__", &MutableValue::Apply<PyNumber_Subtract>)
+        .def("__rsub__", &MutableValue::ApplyReflected<PyNumber_Subtract>)
+        .def("__mul__", &MutableValue::Apply<PyNumber_Multiply>)
+        .def("__rmul__", &MutableValue::ApplyReflected<PyNumber_Multiply>)
+        .def("__truediv__", &MutableValue::Apply<PyNumber_TrueDivide>)
+        .def("__rtruediv__", &MutableValue::ApplyReflected<PyNumber_TrueDivide>)
+        .def("__floordiv__", &MutableValue::Apply<PyNumber_FloorDivide>)
+        .def("__rfloordiv__", &MutableValue::ApplyReflected<PyNumber_FloorDivide>)
+        .def("__mod__", &MutableValue::Apply<PyNumber_Remainder>)
+        .def("__rmod__", &MutableValue::ApplyReflected<PyNumber_Remainder>)
+        .def("__divmod__", &MutableValue::Apply<PyNumber_Divmod>)
+        .def("__rdivmod__", &MutableValue::ApplyReflected<PyNumber_Divmod>)
+        .def("__pow__", &MutableValue::Apply<PowerOf>)
+        .def("__rpow__", &MutableValue::ApplyReflected<PowerOf>)
+        .def("__lshift__", &MutableValue::Apply<PyNumber_Lshift>)
+        .def("__rlshift__", &MutableValue::ApplyReflected<PyNumber_Lshift>)
+        .def("__rshift__", &MutableValue::Apply<PyNumber_Rshift>)
+        .def("__rrshift__", &MutableValue::ApplyReflected<PyNumber_Rshift>)
+        .def("__and__", &MutableValue::Apply<PyNumber_And>)
+        .def("__rand__", &MutableValue::ApplyReflected<PyNumber_And>)
+        .def("__or__", &MutableValue::Apply<PyNumber_Or>)
+        .def("__ror__", &MutableValue::ApplyReflected<PyNumber_Or>)
+        .def("__xor__", &MutableValue::Apply<PyNumber_Xor>)
+        .def("__rxor__", &MutableValue::ApplyReflected<PyNumber_Xor>)
+        .setattr("__hash__", API::Object()); // mutable: unhashable, like other types defining __eq__
+
+    // Yielded by sleep/wait_for to the engine, which resumes the coroutine
+    // Usage: async def on_login(player): await azerothcore.sleep(5000)
+    bp::class_<Awaitable, std::shared_ptr<Awaitable>, boost::noncopyable>("Awaitable", bp::no_init)
+        .def("__await__", &Awaitable::Self)
+        .def("__iter__", &Awaitable::Self)
+        .def("__next__", &Awaitable::Next)
+        .def("send", &Awaitable::Send)
+        .def("__repr__", &Awaitable::GetRepr);
+
+    // Usage: azerothcore.Register("PLAYER_ON_LOGIN", on_login)
     // Usage: azerothcore.Register("CREATURE_ON_GOSSIP_HELLO", on_gossip_hello, 12345)
-    bp::def("Register", &RegisterEntry);
+    // Usage: azerothcore.Register("PLAYER_ON_LOGIN", on_login, flags=azerothcore.HookFlag.Async)
+    // Usage: azerothcore.Register("PLAYER_ON_GIVE_EXP", on_give_exp, flags=azerothcore.HookFlag.Lazy)
+    // Usage: azerothcore.Register("PLAYER_ON_GIVE_EXP", on_give_exp, map=489)
+    // Usage: azerothcore.Register("PLAYER_ON_GIVE_EXP", on_give_exp, filter={"min_level": 80, "gm": False})
+    // Usage: azerothcore.Register("PLAYER_ON_UPDATE", on_player_update, interval_ms=5000)
+    bp::def("Register", &Register,
+            (bp::arg("event"), bp::arg("callback"), bp::arg("entry") = 0, bp::arg("flags") = 0,
+             bp::arg("map") = bp::object(), bp::arg("zone") = bp::object(), bp::arg("area") = bp::object(),
+             bp::arg("filter") = bp::object(), bp::arg("interval_ms") = 0));
+
+    // Usage: azerothcore.RegisterBatch("UNIT_ON_DAMAGE", on_damage_batch, 1000)
+    bp::def("RegisterBatch", &RegisterBatch, (bp::arg("event"), bp::arg("callback"), bp::arg("interval_ms")));
+
+    // Usage: handle = azerothcore.Schedule(5000, on_timeout)
+    bp::def("Schedule", &Schedule, (bp::arg("delay_ms"), bp::arg("callback")));
+
+    // Usage: handle = azerothcore.ScheduleRepeating(60000, on_minute)
+    bp::def("ScheduleRepeating", &ScheduleRepeating, (bp::arg("interval_ms"), bp::arg("callback")));
+
+    // Usage: azerothcore.Cancel(handle)
+    bp::def("Cancel", &Cancel, (bp::arg("handle")));
+
+    // Usage: await azerothcore.sleep(5000)
+    bp::def("sleep", &Sleep, (bp::arg("ms")));
+
+    // Usage: if await azerothcore.wait_for("CREATURE_ON_REMOVE_WORLD", 12345, timeout_ms=60000): ...
+    bp::def("wait_for", &WaitFor, (bp::arg("event"), bp::arg("entry") = 0, bp::arg("timeout_ms") = 0));
+
+    // Usage: azerothcore.GetHookSignature("PLAYER_ON_LOGIN") -> [("player", "Player")]
+    bp::def("GetHookSignature", &GetHookSignature);
+
+    // Usage: open("azerothcore.pyi", "a").write(azerothcore.GenerateHookStubs())
+    bp::def("GenerateHookStubs", &GenerateHookStubs);
 }
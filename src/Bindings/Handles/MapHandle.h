@@ -0,0 +1,65 @@
+#ifndef MOD_PYTHON_ENGINE_MAP_HANDLE_H
+#define MOD_PYTHON_ENGINE_MAP_HANDLE_H
+
+#include "PythonConverter.h"
+#include "Map.h"
+#include "MapMgr.h"
+#include "Object.h"
+
+namespace PyEng
+{
+    /**
+     * @brief Map reference looked up again through MapMgr on every call
+     *
+     * Instance maps are unloaded some time after the last player left, so a
+     * Map stored by a script would dangle. Scripts get this handle instead:
+     * it carries only the map and instance id, and methods called once the
+     * map is unloaded return None (see MapAdapter::Call).
+     */
+    class MapHandle
+    {
+    public:
+        explicit MapHandle(Map const* map) : mapId(map->GetId()), instanceId(map->GetInstanceId()) {}
+
+        [[nodiscard]] uint32 GetId() const noexcept { return mapId; }
+        [[nodiscard]] uint32 GetInstanceId() const noexcept { return instanceId; }
+
+        /**
+         * @brief Looks the map up, nullptr once it is unloaded
+         */
+        [[nodiscard]] Map* Find() const { return sMapMgr->FindMap(mapId, instanceId); }
+
+        /**
+         * @brief Checks if the map is still loaded
+         */
+        [[nodiscard]] bool IsValid() const { return Find() != nullptr; }
+
+        /**
+         * @brief Hash consistent with == (map and instance id)
+         */
+        [[nodiscard]] uint64 GetHash() const noexcept { return (uint64(mapId) << 32) | instanceId; }
+
+        bool operator==(MapHandle const& other) const noexcept
+        {
+            return mapId == other.mapId && instanceId == other.instanceId;
+        }
+
+        bool operator!=(MapHandle const& other) const noexcept { return !(*this == other); }
+
+    private:
+        uint32 mapId;
+        uint32 instanceId;
+    };
+
+    /**
+     * @brief Handle to the map of the object, None if it is in no map
+     */
+    inline Bridge::API::Object GetMapHandle(WorldObject const* object)
+    {
+        Map* map = object ? object->FindMap() : nullptr;
+        return map ? Bridge::API::Object(MapHandle(map)) : Bridge::API::Object();
+    }
+
+} // namespace PyEng
+
+#endif // MOD_PYTHON_ENGINE_MAP_HANDLE_H
@@ -0,0 +1,115 @@
+#ifndef MOD_PYTHON_ENGINE_OBJECT_HANDLE_H
+#define MOD_PYTHON_ENGINE_OBJECT_HANDLE_H
+
+#include "PythonEngine.h"
+#include "MapMgr.h"
+#include "ObjectAccessor.h"
+
+namespace PyEng
+{
+    /**
+     * @brief Lightweight GUID-backed reference to a world object
+     *
+     * Unlike proxies returned by hooks, a handle can be stored by scripts and
+     * used on later ticks: it carries only the ObjectGuid plus map/instance id
+     * and resolves the object on access (ObjectAccessor for players, map object
+     * stores for creatures and gameobjects). The result is cached until the
+     * next world tick, repeated resolutions in the same tick are O(1).
+     *
+     * @note Resolve from the world thread or the map thread owning the object.
+     *       Free-threaded builds don't cache: scripts on several map threads
+     *       may share a handle, and the cache would be written concurrently.
+     */
+    class ObjectHandle
+    {
+    public:
+        ObjectHandle() = default;
+
+        explicit ObjectHandle(WorldObject const* object)
+            : guid(object->GetGUID()), mapId(object->GetMapId()), instanceId(object->GetInstanceId())
+        {
+        }
+
+        explicit ObjectHandle(Hooks::DeferredObject const& object)
+            : guid(object.guid), mapId(object.mapId), instanceId(object.instanceId)
+        {
+        }
+
+        [[nodiscard]] ObjectGuid GetGUID() const noexcept { return guid; }
+        [[nodiscard]] uint32 GetMapId() const noexcept { return mapId; }
+        [[nodiscard]] uint32 GetInstanceId() const noexcept { return instanceId; }
+        [[nodiscard]] bool IsEmpty() const noexcept { return guid.IsEmpty(); }
+
+        /**
+         * @brief Resolves the handle to its (cached) Python proxy (GIL required)
+         *
+         * @return Object proxy, or None if the object is no longer in the world
+         */
+        API::Object Resolve() const
+        {
+#ifdef Py_GIL_DISABLED
+            // The proxy cache still hands out the same object
+            WorldObject* object = Find();
+            return object ? Converter::ToPython(object) : API::Object();
+#else
+            uint32 tick = sPythonEngine->GetWorldTick();
+            if (cachedTick == tick && ProxyCache::IsAlive(cached))
+                return cached;
+
+            WorldObject* object = Find();
+            cached = object ? Converter::ToPython(object) : API::Object();
+            cachedTick = tick;
+
+            return cached;
+#endif
+        }
+
+        /**
+         * @brief Checks if the object can currently be resolved (GIL required)
+         */
+        [[nodiscard]] bool IsValid() const { return !API::IsNone(Resolve()); }
+
+        bool operator==(ObjectHandle const& other) const noexcept { return guid == other.guid; }
+        bool operator!=(ObjectHandle const& other) const noexcept { return guid != other.guid; }
+
+    private:
+        WorldObject* Find() const
+        {
+            if (guid.IsPlayer())
+                return ObjectAccessor::FindPlayer(guid);
+
+            Map* map = sMapMgr->FindMap(mapId, instanceId);
+            if (!map)
+                return nullptr;
+
+            WorldObject* object = nullptr;
+            if (guid.IsCreatureOrPetOrVehicle())
+                object = map->GetCreature(guid);
+            else if (guid.IsGameObject())
+                object = map->GetGameObject(guid);
+
+            return object && object->IsInWorld() ? object : nullptr;
+        }
+
+        ObjectGuid guid;
+        uint32 mapId = 0;
+        uint32 instanceId = 0;
+
+#ifndef Py_GIL_DISABLED
+        // Per-tick resolution cache
+        mutable API::Object cached;
+        mutable uint32 cachedTick = 0;
+#endif
+    };
+
+    /**
+     * @brief Creates a handle to the object (None-safe for Python bindings)
+     */
+    inline ObjectHandle MakeHandle(WorldObject* object)
+    {
+        return object ? ObjectHandle(object) : ObjectHandle();
+    }
+
+} // namespace PyEng
+
+#endif // MOD_PYTHON_ENGINE_OBJECT_HANDLE_H
@@ -23,9 +23,11 @@ REGISTER_TO_SCOPE(Exports, export_item_template_struct, 30);
 REGISTER_TO_SCOPE(Exports, export_item_class, 35);
 // map
 REGISTER_TO_SCOPE(Exports, export_map_class, 40);
+REGISTER_TO_SCOPE(Exports, export_objecthandle_class, 45);
 // spell
 REGISTER_TO_SCOPE(Exports, export_spellinfo_class, 50);
 REGISTER_TO_SCOPE(Exports, export_spellcast_targets_class, 55);
+REGISTER_TO_SCOPE(Exports, export_aura_class, 55);
 
 // Register module name with Python before Py_Initialize()
 extern "C" PyObject* PyInit_azerothcore();
@@ -47,5 +49,10 @@ void InitAzerothCoreModule()
  */
 BOOST_PYTHON_MODULE(azerothcore)
 {
+#ifdef Py_GIL_DISABLED
+    // Single-phase init modules re-enable the GIL on import unless they opt out
+    PyUnstable_Module_SetGIL(boost::python::scope().ptr(), Py_MOD_GIL_NOT_USED);
+#endif
+
     EXECUTE_REGISTRY_SCOPE(Exports);
 }
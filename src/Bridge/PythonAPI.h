@@ -2,7 +2,10 @@
 #define MOD_PYTHON_ENGINE_API_H
 
 #include "PythonHeaders.h"
+#include <array>
+#include <optional>
 #include <string>
+#include <utility>
 
 namespace PyEng::Bridge
 {
@@ -40,6 +43,52 @@ namespace PyEng::Bridge
             return boost::python::exec(boost::python::str(code), globals, locals);
         }
 
+        // Invocation
+        template<std::size_t N>
+        static Object Call(Object const& callable, std::array<Object, N> const& args)
+        {
+            return CallImpl(callable, args, std::make_index_sequence<N>{});
+        }
+
+        /**
+         * @brief Invokes callable through the vectorcall protocol
+         *
+         * Arguments are passed as a stack-allocated array of borrowed
+         * references, without building an argument tuple. One leading slot is
+         * reserved so the callee may prepend 'self' (bound methods).
+         */
+        template<std::size_t N>
+        static Object Vectorcall(Object const& callable, std::array<Object, N> const& args)
+        {
+            PyObject* argv[N + 1];
+            argv[0] = nullptr;
+            for (std::size_t i = 0; i < N; ++i)
+                argv[i + 1] = args[i].ptr();
+
+            PyObject* result = PyObject_Vectorcall(callable.ptr(), argv + 1, N | PY_VECTORCALL_ARGUMENTS_OFFSET,
+                                                   nullptr);
+
+            // NOTE: handle<> throws ErrorAlreadySet if result is null
+            return Object(boost::python::handle<>(result));
+        }
+
+        /**
+         * @brief Copies an array into a read-only typed memoryview
+         *
+         * The data is copied once into a bytes object owned by the view, so
+         * the C++ buffer can be reused right after the call.
+         *
+         * @param format struct module format of T (ex., "Q" for uint64)
+         */
+        template<typename T>
+        static Object ToMemoryView(T const* data, std::size_t count, char const* format)
+        {
+            Object bytes(boost::python::handle<>(
+                PyBytes_FromStringAndSize(reinterpret_cast<char const*>(data), count * sizeof(T))));
+            Object view(boost::python::handle<>(PyMemoryView_FromObject(bytes.ptr())));
+            return view.attr("cast")(format);
+        }
+
         // Pointer wrapper
         template<typename T>
         static auto Ptr(T* ptr)
@@ -57,9 +106,74 @@ namespace PyEng::Bridge
         // Checks
         static bool IsNone(Object const& obj) { return obj.ptr() == Py_None; }
         static bool IsCallable(Object const& obj) { return PyCallable_Check(obj.ptr()); }
+        static bool HasVectorcall(Object const& obj) { return PyVectorcall_Function(obj.ptr()) != nullptr; }
+        static bool IsCoroutine(Object const& obj) { return PyCoro_CheckExact(obj.ptr()); }
+
+        /**
+         * @brief Checks if the GIL is enabled (always true unless free-threaded)
+         *
+         * A free-threaded interpreter turns it back on for PYTHON_GIL=1 and
+         * when importing an extension module without free-threading support.
+         */
+        static bool IsGILEnabled()
+        {
+#ifdef Py_GIL_DISABLED
+            return Extract<bool>(Import("sys").attr("_is_gil_enabled")());
+#else
+            return true;
+#endif
+        }
+
+        /**
+         * @brief Resumes a coroutine (coroutine.send)
+         *
+         * @param value Result of the awaited expression (None to start the coroutine)
+         * @param result [out] Yielded value if suspended, otherwise the returned value
+         * @return True if the coroutine is suspended, false if it returned
+         */
+        static bool Send(Object const& coroutine, Object const& value, Object& result)
+        {
+            PyObject* out = nullptr;
+            PySendResult status = PyIter_Send(coroutine.ptr(), value.ptr(), &out);
+
+            // NOTE: handle<> throws ErrorAlreadySet if out is null
+            result = Object(boost::python::handle<>(out));
+            return status == PYGEN_NEXT;
+        }
+
+        /**
+         * @brief Reads a callback result as a predicate answer
+         *
+         * None (no return statement) means no answer; True/False are compared
+         * by identity, other objects (ex., int) use their truth value.
+         *
+         * @return Answer, or std::nullopt for None
+         */
+        static std::optional<bool> ToPredicate(Object const& result)
+        {
+            PyObject* object = result.ptr();
+            if (object == Py_None)
+                return std::nullopt;
+            if (object == Py_True)
+                return true;
+            if (object == Py_False)
+                return false;
+
+            int truth = PyObject_IsTrue(object);
+            if (truth < 0)
+                boost::python::throw_error_already_set();
+
+            return truth != 0;
+        }
 
     private:
         API() = delete;
+
+        template<std::size_t N, std::size_t... I>
+        static Object CallImpl(Object const& callable, std::array<Object, N> const& args, std::index_sequence<I...>)
+        {
+            return callable(args[I]...);
+        }
     };
 
 } // namespace PyEng::Bridge
@@ -0,0 +1,42 @@
+#include "PythonAwaitable.h"
+#include "HookNameTable.h"
+
+namespace PyEng::Bridge
+{
+    API::Object Awaitable::Send(API::Object const& self, API::Object const& value)
+    {
+        Awaitable& awaitable = boost::python::extract<Awaitable&>(self);
+        if (!awaitable.yielded)
+        {
+            awaitable.yielded = true;
+            return self;
+        }
+
+        // Instantiated first: a tuple value would be unpacked as arguments
+        PyObject* stop = PyObject_CallOneArg(PyExc_StopIteration, value.ptr());
+        if (stop)
+        {
+            PyErr_SetObject(PyExc_StopIteration, stop);
+            Py_DECREF(stop);
+        }
+
+        boost::python::throw_error_already_set();
+        return API::Object();
+    }
+
+    std::string Awaitable::GetRepr() const
+    {
+        if (kind == Kind::Sleep)
+            return "<Awaitable sleep(" + std::to_string(delay) + ")>";
+
+        std::string repr = "<Awaitable wait_for(";
+        repr.append(Hooks::GetHookName(hinfo));
+        if (entryId)
+            repr.append(", entry=").append(std::to_string(entryId));
+        if (delay)
+            repr.append(", timeout_ms=").append(std::to_string(delay));
+
+        return repr.append(")>");
+    }
+
+} // namespace PyEng::Bridge
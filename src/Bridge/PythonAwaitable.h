@@ -0,0 +1,75 @@
+#ifndef MOD_PYTHON_ENGINE_AWAITABLE_H
+#define MOD_PYTHON_ENGINE_AWAITABLE_H
+
+#include "PythonAPI.h"
+#include "HookInfo.h"
+#include <string>
+
+namespace PyEng::Bridge
+{
+    /**
+     * @brief Object awaited by coroutine callbacks (azerothcore.sleep, azerothcore.wait_for)
+     *
+     * Its __await__ iterator yields the awaitable itself: the engine reads
+     * what to wait for and parks the coroutine in C++ (timing wheel or hook
+     * waiter) without holding the GIL. The coroutine is resumed with the
+     * value of the await expression, which ends the iteration. An awaitable
+     * can be awaited once.
+     */
+    class Awaitable
+    {
+    public:
+        enum class Kind : uint8
+        {
+            Sleep, // resumed with None after the delay
+            Event, // resumed with True once the hook is raised, False on timeout
+        };
+
+        Awaitable(Kind kind, uint32 delay, Hooks::HookInfo hinfo = {}, uint32 entryId = 0)
+            : kind(kind), delay(delay), hinfo(hinfo), entryId(entryId) {}
+
+        /**
+         * @brief Returns the object itself (Python __await__ and __iter__)
+         */
+        static API::Object Self(API::Object const& self) { return self; }
+
+        /**
+         * @brief Iterator step (Python send): yields the awaitable once, then ends with the value
+         *
+         * @param self Python object wrapping the awaitable
+         * @param value Value sent by the engine on resumption
+         * @return The awaitable on the first step (raises StopIteration(value) afterwards)
+         */
+        static API::Object Send(API::Object const& self, API::Object const& value);
+
+        /**
+         * @brief Iterator step without value (Python __next__)
+         */
+        static API::Object Next(API::Object const& self) { return Send(self, API::Object()); }
+
+        /**
+         * @brief Kind, delay and hook (Python __repr__)
+         */
+        std::string GetRepr() const;
+
+        [[nodiscard]] Kind GetKind() const noexcept { return kind; }
+
+        /**
+         * @brief Sleep delay or event timeout in milliseconds (0: no timeout)
+         */
+        [[nodiscard]] uint32 GetDelay() const noexcept { return delay; }
+
+        [[nodiscard]] Hooks::HookInfo GetHook() const noexcept { return hinfo; }
+        [[nodiscard]] uint32 GetEntry() const noexcept { return entryId; }
+
+    private:
+        Kind kind;
+        uint32 delay;
+        Hooks::HookInfo hinfo;
+        uint32 entryId;
+        bool yielded = false;
+    };
+
+} // namespace PyEng::Bridge
+
+#endif // MOD_PYTHON_ENGINE_AWAITABLE_H
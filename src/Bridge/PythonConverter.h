@@ -2,7 +2,10 @@
 #define MOD_PYTHON_ENGINE_CONVERTER_H
 
 #include "PythonAPI.h"
+#include "PythonProxyCache.h"
+#include "BufferView.h"
 #include <string>
+#include <type_traits>
 #include <utility>
 
 namespace PyEng::Bridge
@@ -13,20 +16,38 @@ namespace PyEng::Bridge
     class Converter
     {
     public:
-        // Generic value conversion
+        // Generic value conversion (arithmetic types go straight to the C API,
+        // skipping the Boost.Python converter registry)
         template<typename T>
         static API::Object ToPython(T&& value)
         {
-            return API::Object(std::forward<T>(value));
+            using Value = std::decay_t<T>;
+
+            if constexpr (std::is_same_v<Value, bool>)
+                return API::Object(boost::python::handle<>(PyBool_FromLong(value)));
+            else if constexpr (std::is_integral_v<Value> && std::is_signed_v<Value>)
+                return API::Object(boost::python::handle<>(PyLong_FromLongLong(value)));
+            else if constexpr (std::is_integral_v<Value>)
+                return API::Object(boost::python::handle<>(PyLong_FromUnsignedLongLong(value)));
+            else if constexpr (std::is_floating_point_v<Value>)
+                return API::Object(boost::python::handle<>(PyFloat_FromDouble(value)));
+            else if constexpr (std::is_same_v<Value, Utilities::BufferView>)
+                return FromBuffer(value);
+            else
+                return API::Object(std::forward<T>(value));
         }
 
-        // Pointer conversion
+        // Pointer conversion (in-world objects reuse their cached proxy)
         template<typename T>
         static API::Object ToPython(T* ptr)
         {
             if (!ptr)
                 return API::Object();
-            return API::Object(API::Ptr(ptr));
+
+            if constexpr (ProxyCache::IsCacheable<T>)
+                return ProxyCache::Get(ptr);
+            else
+                return API::Object(API::Ptr(ptr));
         }
 
         // String conversions
@@ -35,6 +56,14 @@ namespace PyEng::Bridge
 
     private:
         Converter() = delete;
+
+        // Read-only memoryview over a copy: the buffer only lives for the
+        // dispatch, while scripts may keep the view, its slices or exports
+        static API::Object FromBuffer(Utilities::BufferView const& buffer)
+        {
+            static uint8 const empty = 0;
+            return API::ToMemoryView(buffer.data ? buffer.data : &empty, buffer.size, "B");
+        }
     };
 
 } // namespace PyEng::Bridge
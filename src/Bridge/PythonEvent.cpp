@@ -0,0 +1,166 @@
+#include "PythonEvent.h"
+#include "HookNameTable.h"
+
+namespace PyEng::Bridge
+{
+    API::Object HookEvent::GetAttribute(std::string const& name) const
+    {
+        if (!source)
+        {
+            PyErr_SetString(PyExc_RuntimeError, "HookEvent is only valid during its dispatch");
+            boost::python::throw_error_already_set();
+        }
+
+        if (auto const* description = Hooks::FindHookDescription(hinfo))
+            for (std::size_t i = 0; i < description->arity; ++i)
+                if (description->parameters[i].name == name)
+                    return source->GetArgument(i);
+
+        PyErr_Format(PyExc_AttributeError, "'%s' event has no argument '%s'",
+                     std::string(Hooks::GetHookName(hinfo)).c_str(), name.c_str());
+        boost::python::throw_error_already_set();
+        return API::Object();
+    }
+
+    std::string HookEvent::GetRepr() const
+    {
+        std::string repr = "<HookEvent ";
+        repr.append(Hooks::GetHookName(hinfo)).append("(");
+
+        if (auto const* description = Hooks::FindHookDescription(hinfo))
+        {
+            for (std::size_t i = 0; i < description->arity; ++i)
+            {
+                if (i)
+                    repr.append(", ");
+                repr.append(description->parameters[i].name);
+            }
+        }
+
+        repr.append(source ? ")>" : ") unbound>");
+        return repr;
+    }
+
+    API::Object MutableValue::GetValue() const
+    {
+        switch (kind)
+        {
+            case Kind::Boolean:
+                return Converter::ToPython(unsignedValue != 0);
+            case Kind::Signed:
+                return Converter::ToPython(signedValue);
+            case Kind::Unsigned:
+                return Converter::ToPython(unsignedValue);
+            case Kind::Real:
+                return Converter::ToPython(realValue);
+            default:
+                break;
+        }
+
+        PyErr_SetString(PyExc_RuntimeError, "MutableValue is only valid during its dispatch");
+        boost::python::throw_error_already_set();
+        return API::Object();
+    }
+
+    void MutableValue::SetValue(API::Object const& value)
+    {
+        PyObject* object = value.ptr();
+
+        switch (kind)
+        {
+            case Kind::Boolean:
+            {
+                int truth = PyObject_IsTrue(object);
+                if (truth < 0)
+                    boost::python::throw_error_already_set();
+
+                unsignedValue = truth;
+                return;
+            }
+            case Kind::Signed:
+            {
+                int overflow = 0;
+                long long number = PyLong_AsLongLongAndOverflow(object, &overflow);
+                if (number == -1 && PyErr_Occurred())
+                    boost::python::throw_error_already_set();
+
+                if (overflow || number < signedMinimum || number > signedMaximum)
+                {
+                    PyErr_Format(PyExc_OverflowError, "value out of range [%lld, %lld]",
+                                 static_cast<long long>(signedMinimum), static_cast<long long>(signedMaximum));
+                    boost::python::throw_error_already_set();
+                }
+
+                signedValue = number;
+                return;
+            }
+            case Kind::Unsigned:
+            {
+                // Raises TypeError for non-int, OverflowError for negative values
+                unsigned long long number = PyLong_AsUnsignedLongLong(object);
+                if (number == static_cast<unsigned long long>(-1) && PyErr_Occurred())
+                    boost::python::throw_error_already_set();
+
+                if (number > unsignedMaximum)
+                {
+                    PyErr_Format(PyExc_OverflowError, "value out of range [0, %llu]",
+                                 static_cast<unsigned long long>(unsignedMaximum));
+                    boost::python::throw_error_already_set();
+                }
+
+                unsignedValue = number;
+                return;
+            }
+            case Kind::Real:
+            {
+                double number = PyFloat_AsDouble(object);
+                if (number == -1.0 && PyErr_Occurred())
+                    boost::python::throw_error_already_set();
+
+                realValue = number;
+                return;
+            }
+            default:
+                break;
+        }
+
+        PyErr_SetString(PyExc_RuntimeError, "MutableValue is only valid during its dispatch");
+        boost::python::throw_error_already_set();
+    }
+
+    std::string MutableValue::GetRepr() const
+    {
+        if (!IsBound())
+            return "MutableValue(unbound)";
+
+        return "MutableValue(" + GetString() + ")";
+    }
+
+    std::string MutableValue::GetString() const
+    {
+        return boost::python::extract<std::string>(boost::python::str(GetValue()));
+    }
+
+    std::string MutableValue::Format(std::string const& spec) const
+    {
+        API::Object formatted(boost::python::handle<>(
+            PyObject_Format(GetValue().ptr(), boost::python::str(spec).ptr())));
+        return boost::python::extract<std::string>(formatted);
+    }
+
+    bool MutableValue::IsTrue() const
+    {
+        int truth = PyObject_IsTrue(GetValue().ptr());
+        if (truth < 0)
+            boost::python::throw_error_already_set();
+
+        return truth != 0;
+    }
+
+    API::Object MutableValue::Round(API::Object const& digits) const
+    {
+        API::Object value = GetValue();
+        return API::IsNone(digits) ? value.attr("__round__")() : value.attr("__round__")(digits);
+    }
+
+} // namespace PyEng::Bridge
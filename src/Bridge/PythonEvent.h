@@ -0,0 +1,498 @@
+#ifndef MOD_PYTHON_ENGINE_EVENT_H
+#define MOD_PYTHON_ENGINE_EVENT_H
+
+#include "PythonAPI.h"
+#include "PythonConverter.h"
+#include "HookInfo.h"
+#include <array>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace PyEng::Bridge
+{
+    /**
+     * @brief Arguments of a running dispatch, converted on demand
+     */
+    class EventSource
+    {
+    public:
+        /**
+         * @brief Python value of the argument, converted on first use (GIL required)
+         */
+        virtual API::Object const& GetArgument(std::size_t index) = 0;
+
+    protected:
+        ~EventSource() = default;
+    };
+
+    /**
+     * @brief Event object passed to callbacks registered with HookFlag.Lazy
+     *
+     * Exposes the hook arguments as attributes named after the parameters
+     * declared in DEFINE_GAME_HOOK (ex., event.amount). An argument is
+     * converted on its first access and shared with every other callback of
+     * the same dispatch; after the dispatch the event is unbound and any
+     * access raises RuntimeError.
+     */
+    class HookEvent
+    {
+    public:
+        /**
+         * @brief Attribute lookup (Python __getattr__)
+         *
+         * @param name Declared parameter name
+         * @return Argument value
+         */
+        API::Object GetAttribute(std::string const& name) const;
+
+        /**
+         * @brief Hook name and parameters (Python __repr__)
+         */
+        std::string GetRepr() const;
+
+        void Bind(Hooks::HookInfo hinfo, EventSource* source) noexcept
+        {
+            this->hinfo = hinfo;
+            this->source = source;
+        }
+
+        void Unbind() noexcept { source = nullptr; }
+
+        [[nodiscard]] bool IsBound() const noexcept { return source != nullptr; }
+
+    private:
+        Hooks::HookInfo hinfo{};
+        EventSource* source = nullptr; // null when unbound
+    };
+
+    /**
+     * @brief Mutable box passed for by-reference arithmetic hook arguments
+     *
+     * Holds a copy of the referenced value; scripts read and assign it
+     * through .value, and the final value is written back to the C++
+     * reference once every callback of the dispatch has run. Assignments
+     * are checked against the declared type (TypeError, OverflowError).
+     *
+     * The box also behaves as its value in expressions (amount > x,
+     * amount * 2, int(amount)), so handlers written for plain numbers keep
+     * working. Results are plain numbers: only assigning .value changes
+     * the argument.
+     */
+    class MutableValue
+    {
+    public:
+        /**
+         * @brief Current value (Python .value getter)
+         */
+        API::Object GetValue() const;
+
+        /**
+         * @brief Assigns the value (Python .value setter)
+         *
+         * @param value Python number fitting the declared type
+         */
+        void SetValue(API::Object const& value);
+
+        /**
+         * @brief Python __repr__
+         */
+        std::string GetRepr() const;
+
+        /**
+         * @brief Python __str__ and __format__ of the value
+         */
+        std::string GetString() const;
+        std::string Format(std::string const& spec) const;
+
+        /**
+         * @brief Python __bool__ of the value
+         */
+        bool IsTrue() const;
+
+        /**
+         * @brief Python __round__ of the value
+         *
+         * @param digits Number of decimals, None to round to an integer
+         */
+        API::Object Round(API::Object const& digits) const;
+
+        /**
+         * @brief Unary number operation on the value (ex., __int__, __neg__)
+         */
+        template<PyObject* (*Operation)(PyObject*)>
+        API::Object Apply() const
+        {
+            return API::Object(boost::python::handle<>(Operation(GetValue().ptr())));
+        }
+
+        /**
+         * @brief Binary number operation, the value as left operand (ex., __add__)
+         */
+        template<PyObject* (*Operation)(PyObject*, PyObject*)>
+        API::Object Apply(API::Object const& other) const
+        {
+            return API::Object(boost::python::handle<>(Operation(GetValue().ptr(), other.ptr())));
+        }
+
+        /**
+         * @brief Binary number operation, the value as right operand (ex., __radd__)
+         */
+        template<PyObject* (*Operation)(PyObject*, PyObject*)>
+        API::Object ApplyReflected(API::Object const& other) const
+        {
+            return API::Object(boost::python::handle<>(Operation(other.ptr(), GetValue().ptr())));
+        }
+
+        /**
+         * @brief Rich comparison of the value (ex., __lt__ for Py_LT)
+         */
+        template<int Comparison>
+        API::Object Compare(API::Object const& other) const
+        {
+            PyObject* result = PyObject_RichCompare(GetValue().ptr(), other.ptr(), Comparison);
+            return API::Object(boost::python::handle<>(result));
+        }
+
+        /**
+         * @brief Binds the box to the value of a by-reference argument
+         */
+        template<typename T>
+        void Bind(T value) noexcept
+        {
+            static_assert(std::is_arithmetic_v<T>, "Only arithmetic arguments can be boxed");
+
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                kind = Kind::Boolean;
+                unsignedValue = value;
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                kind = Kind::Real;
+                realValue = value;
+            }
+            else if constexpr (std::is_signed_v<T>)
+            {
+                kind = Kind::Signed;
+                signedValue = value;
+                signedMinimum = std::numeric_limits<T>::min();
+                signedMaximum = std::numeric_limits<T>::max();
+            }
+            else
+            {
+                kind = Kind::Unsigned;
+                unsignedValue = value;
+                unsignedMaximum = std::numeric_limits<T>::max();
+            }
+        }
+
+        /**
+         * @brief Value to write back (T must match the bound type)
+         */
+        template<typename T>
+        [[nodiscard]] T Get() const noexcept
+        {
+            if constexpr (std::is_floating_point_v<T>)
+                return static_cast<T>(realValue);
+            else if constexpr (std::is_signed_v<T>)
+                return static_cast<T>(signedValue);
+            else
+                return static_cast<T>(unsignedValue);
+        }
+
+        void Unbind() noexcept { kind = Kind::Unbound; }
+
+        [[nodiscard]] bool IsBound() const noexcept { return kind != Kind::Unbound; }
+
+    private:
+        enum class Kind : uint8
+        {
+            Unbound,
+            Boolean,
+            Signed,
+            Unsigned,
+            Real,
+        };
+
+        Kind kind = Kind::Unbound;
+        int64 signedValue = 0;
+        int64 signedMinimum = 0;
+        int64 signedMaximum = 0;
+        uint64 unsignedValue = 0;
+        uint64 unsignedMaximum = 0;
+        double realValue = 0.0;
+    };
+
+    /**
+     * @brief Pool of reusable Python objects wrapping T (GIL required)
+     *
+     * An instance is reused once it is unbound and no script keeps a
+     * reference to it, so steady-state dispatch does not allocate Python
+     * objects. T must be exported with std::shared_ptr<T> as holder.
+     *
+     * Free-threaded builds keep one pool per thread: dispatches running in
+     * parallel would otherwise pick the same free instance.
+     *
+     * @tparam T HookEvent or MutableValue
+     */
+    template<typename T>
+    class InstancePool
+    {
+    public:
+        /**
+         * @brief Takes a free instance, creating one if all are in use
+         *
+         * @param instance [out] C++ instance, to be bound by the caller
+         * @return Python object wrapping the instance
+         */
+        static API::Object Acquire(T*& instance)
+        {
+            std::vector<Entry>& pool = GetPool();
+
+            // Free: unbound and referenced by the pool only
+            for (Entry const& entry : pool)
+            {
+                if (entry.instance->IsBound() || Py_REFCNT(entry.object.ptr()) > 1)
+                    continue;
+
+                instance = entry.instance;
+                return entry.object;
+            }
+
+            API::Object object(std::make_shared<T>());
+            instance = boost::python::extract<T*>(object);
+
+            if (pool.size() < MAX_POOLED)
+                pool.push_back(Entry{object, instance});
+
+            return object;
+        }
+
+        /**
+         * @brief Drops all pooled instances (no dispatch may be running)
+         */
+        static void Clear()
+        {
+#ifdef Py_GIL_DISABLED
+            std::lock_guard<std::mutex> lock(poolsMutex);
+            for (std::vector<Entry>& pool : pools)
+                pool.clear();
+#else
+            pool.clear();
+#endif
+        }
+
+    private:
+        InstancePool() = delete;
+
+        static constexpr std::size_t MAX_POOLED = 32;
+
+        struct Entry
+        {
+            API::Object object;
+            T* instance;
+        };
+
+#ifdef Py_GIL_DISABLED
+        // Pools are owned here, not by the threads: Clear() releases them
+        // before finalization, whichever thread filled them
+        static std::vector<Entry>& GetPool()
+        {
+            thread_local std::vector<Entry>* local = nullptr;
+            if (!local)
+            {
+                std::lock_guard<std::mutex> lock(poolsMutex);
+                local = &pools.emplace_back();
+            }
+
+            return *local;
+        }
+
+        inline static std::mutex poolsMutex;
+        inline static std::deque<std::vector<Entry>> pools; // stable addresses
+#else
+        static std::vector<Entry>& GetPool() noexcept { return pool; }
+
+        inline static std::vector<Entry> pool;
+#endif
+    };
+
+    /**
+     * @brief Checks if values of the type carry a GUID (ex., ObjectHandle)
+     */
+    template<typename T, typename = void>
+    inline constexpr bool HasGuidMember = false;
+
+    template<typename T>
+    inline constexpr bool HasGuidMember<T, std::void_t<decltype(std::declval<T const&>().GetGUID())>> = true;
+
+    /**
+     * @brief Typed arguments of a dispatch, converted once and shared
+     *
+     * Eager callbacks get all converted arguments, lazy ones an event that
+     * converts only what the script reads. Either way each argument is
+     * converted at most once. Non-const references to arithmetic values are
+     * passed as MutableValue and stored back by WriteBack(). Must be
+     * destroyed with the GIL held.
+     *
+     * @tparam Args Argument types (references to values living for the dispatch)
+     */
+    template<typename... Args>
+    class EventArguments final : public EventSource
+    {
+    public:
+        static constexpr std::size_t COUNT = sizeof...(Args);
+
+        /**
+         * @brief Checks if the argument is passed as MutableValue
+         */
+        template<typename T>
+        static constexpr bool IsMutable = std::is_lvalue_reference_v<T> &&
+                                          !std::is_const_v<std::remove_reference_t<T>> &&
+                                          std::is_arithmetic_v<std::remove_reference_t<T>>;
+
+        EventArguments(Hooks::HookInfo hinfo, Args&&... args) : hinfo(hinfo), values(std::forward<Args>(args)...) {}
+
+        ~EventArguments()
+        {
+            if (event)
+                event->Unbind();
+
+            for (MutableValue* box : boxes)
+                if (box)
+                    box->Unbind();
+        }
+
+        EventArguments(EventArguments const&) = delete;
+        EventArguments& operator=(EventArguments const&) = delete;
+
+        API::Object const& GetArgument(std::size_t index) override
+        {
+            if (!converted[index])
+            {
+                ConvertAt(index, std::index_sequence_for<Args...>{});
+                converted[index] = true;
+            }
+
+            return cache[index];
+        }
+
+        /**
+         * @brief All arguments converted (eager calling convention)
+         */
+        std::array<API::Object, COUNT> const& GetAll()
+        {
+            for (std::size_t i = 0; i < COUNT; ++i)
+                GetArgument(i);
+
+            return cache;
+        }
+
+        /**
+         * @brief Event object bound to these arguments (lazy calling convention)
+         */
+        API::Object const& GetEvent()
+        {
+            if (!event)
+            {
+                eventObject = InstancePool<HookEvent>::Acquire(event);
+                event->Bind(hinfo, this);
+            }
+
+            return eventObject;
+        }
+
+        /**
+         * @brief GUID raw value of the game object the event is about, 0 if none
+         *
+         * Read from the first argument: an in-world object pointer (Player,
+         * Creature, GameObject...) or a value carrying a GUID (ObjectHandle).
+         * Objects whose removal from the world is not notified (pets) have no
+         * owner GUID: nothing would release it.
+         */
+        [[nodiscard]] uint64 GetOwner() const noexcept
+        {
+            if constexpr (COUNT > 0)
+                return OwnerOf(std::get<0>(values));
+            else
+                return 0;
+        }
+
+        /**
+         * @brief Stores the boxed values into the by-reference arguments
+         *
+         * Called once after every callback of the dispatch has run; arguments
+         * no script read keep their value.
+         */
+        void WriteBack() noexcept { WriteBack(std::index_sequence_for<Args...>{}); }
+
+    private:
+        template<typename T>
+        static uint64 OwnerOf(T const& value) noexcept
+        {
+            using Value = std::decay_t<T>;
+
+            ObjectGuid guid;
+            if constexpr (std::is_pointer_v<Value> && ProxyCache::IsCacheable<std::remove_pointer_t<Value>>)
+                guid = value ? value->GetGUID() : ObjectGuid::Empty;
+            else if constexpr (!std::is_pointer_v<Value> && HasGuidMember<Value>)
+                guid = value.GetGUID();
+
+            return ProxyCache::IsTracked(guid) ? guid.GetRawValue() : 0;
+        }
+
+        template<std::size_t I>
+        void Convert()
+        {
+            using Arg = std::tuple_element_t<I, std::tuple<Args...>>;
+
+            if constexpr (IsMutable<Arg>)
+            {
+                cache[I] = InstancePool<MutableValue>::Acquire(boxes[I]);
+                boxes[I]->Bind(std::get<I>(values));
+            }
+            else
+                cache[I] = Converter::ToPython(std::get<I>(values));
+        }
+
+        template<std::size_t... I>
+        void ConvertAt(std::size_t index, std::index_sequence<I...>)
+        {
+            ((I == index ? (Convert<I>(), 0) : 0), ...);
+        }
+
+        template<std::size_t... I>
+        void WriteBack(std::index_sequence<I...>) noexcept
+        {
+            (WriteBackAt<I>(), ...);
+        }
+
+        template<std::size_t I>
+        void WriteBackAt() noexcept
+        {
+            using Arg = std::tuple_element_t<I, std::tuple<Args...>>;
+
+            if constexpr (IsMutable<Arg>)
+                if (boxes[I])
+                    std::get<I>(values) = boxes[I]->template Get<std::remove_reference_t<Arg>>();
+        }
+
+        Hooks::HookInfo hinfo;
+        std::tuple<Args&&...> values;
+        std::array<API::Object, COUNT> cache;
+        std::array<bool, COUNT> converted{};
+        std::array<MutableValue*, COUNT> boxes{}; // by-reference arguments only
+        HookEvent* event = nullptr;
+        API::Object eventObject;
+    };
+
+} // namespace PyEng::Bridge
+
+#endif // MOD_PYTHON_ENGINE_EVENT_H
@@ -0,0 +1,58 @@
+#ifndef MOD_PYTHON_ENGINE_MUTEX_H
+#define MOD_PYTHON_ENGINE_MUTEX_H
+
+#include "PythonHeaders.h"
+#include <mutex>
+
+namespace PyEng::Bridge
+{
+#ifdef Py_GIL_DISABLED
+    /**
+     * @brief Mutex for engine state locked by threads running Python
+     *
+     * Free-threaded builds have no GIL to take first: a thread blocked on a
+     * plain mutex while attached to the interpreter would never reach the
+     * stop-the-world pause that the holder may be waiting for (a garbage
+     * collection started by an allocation under the lock). A contended lock
+     * detaches the thread state while waiting, like the interpreter's own
+     * locks. Usable from detached threads as well.
+     */
+    class InterpreterMutex
+    {
+    public:
+        InterpreterMutex() = default;
+
+        InterpreterMutex(InterpreterMutex const&) = delete;
+        InterpreterMutex& operator=(InterpreterMutex const&) = delete;
+
+        void lock()
+        {
+            if (mutex.try_lock())
+                return;
+
+            PyThreadState* state = PyThreadState_GetUnchecked();
+            if (!state)
+            {
+                mutex.lock();
+                return;
+            }
+
+            PyEval_SaveThread();
+            mutex.lock();
+            PyEval_RestoreThread(state);
+        }
+
+        bool try_lock() { return mutex.try_lock(); }
+        void unlock() { mutex.unlock(); }
+
+    private:
+        std::mutex mutex;
+    };
+#else
+    // With the GIL, acquiring it before the mutex is enough (see lock order)
+    using InterpreterMutex = std::mutex;
+#endif
+
+} // namespace PyEng::Bridge
+
+#endif // MOD_PYTHON_ENGINE_MUTEX_H
@@ -2,6 +2,8 @@
 #define MOD_PYTHON_ENGINE_OUTPUT_H
 
 #include "PythonAPI.h"
+#include "PythonMutex.h"
+#include <mutex>
 #include <string>
 
 namespace PyEng::Bridge
@@ -12,12 +14,20 @@ namespace PyEng::Bridge
      * Redirects sys.stdout and sys.stderr to a StringIO buffer, automatically
      * restoring original streams on destruction. Requires GIL to be held during
      * construction and destruction.
+     *
+     * The streams are interpreter-wide. Free-threaded builds serialize the
+     * captures, so that each one restores the streams it replaced; output
+     * printed meanwhile by callbacks running on other threads is captured too.
      */
     class OutputCapture
     {
     public:
         OutputCapture()
-            : sysModule(API::Import("sys")),
+            :
+#ifdef Py_GIL_DISABLED
+              lock(captureMutex),
+#endif
+              sysModule(API::Import("sys")),
               ioModule(API::Import("io")),
               oldStdout(sysModule.attr("stdout")),
               oldStderr(sysModule.attr("stderr")),
@@ -51,6 +61,11 @@ namespace PyEng::Bridge
         }
 
     private:
+#ifdef Py_GIL_DISABLED
+        inline static InterpreterMutex captureMutex;
+
+        std::lock_guard<InterpreterMutex> lock; // released after the streams are restored
+#endif
         API::Object sysModule;
         API::Object ioModule;
         API::Object oldStdout;
@@ -0,0 +1,270 @@
+#ifndef MOD_PYTHON_ENGINE_PROXY_CACHE_H
+#define MOD_PYTHON_ENGINE_PROXY_CACHE_H
+
+#include "PythonAPI.h"
+#include "PythonGIL.h"
+#include "PythonMutex.h"
+#include "RcuPointer.h"
+#include "Object.h"
+#include <boost/python/object/instance.hpp>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace PyEng::Bridge
+{
+    /**
+     * @brief Cache of Python proxies for in-world game objects
+     *
+     * Hands out the same Python object for a Player/Creature/GameObject while
+     * it stays in the world, which avoids creating a new wrapper on every
+     * conversion and gives scripts stable identity ('is', dict keys).
+     *
+     * Proxies are invalidated when the object leaves the world (logout,
+     * remove-from-world): the cached wrapper is neutered, so scripts holding a
+     * stale reference get a Python error instead of a dangling pointer.
+     */
+    class ProxyCache
+    {
+    public:
+        /**
+         * @brief Checks if pointers of the type can be cached
+         */
+        template<typename T>
+        static constexpr bool IsCacheable = std::is_base_of_v<WorldObject, std::remove_cv_t<T>>;
+
+        /**
+         * @brief Returns cached proxy, creating it on first use (GIL required)
+         *
+         * @param object In-world game object (non-null)
+         * @return Python proxy object
+         */
+        template<typename T>
+        static API::Object Get(T* object)
+        {
+            ObjectGuid guid = object->GetGUID();
+            if (!IsTracked(guid))
+                return API::Object(API::Ptr(object));
+
+            void const* address = static_cast<WorldObject const*>(object);
+            PyObject* stale = nullptr;
+            API::Object proxy;
+
+            {
+                std::lock_guard<InterpreterMutex> lock(mutex);
+
+                auto itr = proxies.find(guid.GetRawValue());
+                if (itr != proxies.end())
+                {
+                    if (itr->second.address == address)
+                        return API::Object(boost::python::handle<>(boost::python::borrowed(itr->second.proxy)));
+
+                    // Missed invalidation: guid reused by another object
+                    stale = itr->second.proxy;
+                    proxies.erase(itr);
+                }
+
+                proxy = API::Object(API::Ptr(object));
+                Py_INCREF(proxy.ptr());
+                proxies.emplace(guid.GetRawValue(), Entry{address, proxy.ptr()});
+                count.store(proxies.size(), std::memory_order_relaxed);
+            }
+
+            if (stale)
+                Release(stale);
+
+            return proxy;
+        }
+
+        /**
+         * @brief Neuters and drops the proxy of the object (any thread)
+         *
+         * The GIL is only acquired if a proxy exists for the guid.
+         *
+         * @param guid Object leaving the world
+         */
+        static void Invalidate(ObjectGuid guid)
+        {
+            if (!count.load(std::memory_order_relaxed) || !IsTracked(guid))
+                return;
+
+            PyObject* proxy = nullptr;
+
+            {
+                std::lock_guard<InterpreterMutex> lock(mutex);
+
+                auto itr = proxies.find(guid.GetRawValue());
+                if (itr == proxies.end())
+                    return;
+
+                // Refcounts are not touched until the GIL is held
+                proxy = itr->second.proxy;
+                proxies.erase(itr);
+                count.store(proxies.size(), std::memory_order_relaxed);
+            }
+
+            GILGuard gil;
+            Release(proxy);
+        }
+
+        /**
+         * @brief Checks if the proxy still points to a live object (GIL required)
+         *
+         * @param proxy Proxy returned by Get() or None
+         * @return False for None and for neutered proxies
+         */
+        static bool IsAlive(API::Object const& proxy) noexcept
+        {
+            if (API::IsNone(proxy))
+                return false;
+
+            return reinterpret_cast<boost::python::objects::instance<>*>(proxy.ptr())->objects != nullptr;
+        }
+
+        /**
+         * @brief Neuters and drops all proxies (GIL required, no script running)
+         */
+        static void Clear()
+        {
+            std::unordered_map<uint64, Entry> expired;
+
+            {
+                std::lock_guard<InterpreterMutex> lock(mutex);
+                expired.swap(proxies);
+                count.store(0, std::memory_order_relaxed);
+            }
+
+            for (auto const& [guid, entry] : expired)
+                Release(entry.proxy);
+
+            CollectRetired(true);
+        }
+
+        /**
+         * @brief Destroys the holders of neutered proxies no thread can still use
+         *
+         * Only free-threaded builds defer the teardown, see Release(). The
+         * GIL (thread state) is only acquired if a holder can be destroyed.
+         *
+         * @param all Destroy every retired holder (no script may be running)
+         */
+        static void CollectRetired([[maybe_unused]] bool all = false)
+        {
+#ifdef Py_GIL_DISABLED
+            if (!retiredCount.load(std::memory_order_relaxed))
+                return;
+
+            uint64 oldest = all ? std::numeric_limits<uint64>::max() : Utilities::EpochDomain::OldestActive();
+            std::vector<Retired> expired;
+
+            {
+                std::lock_guard<InterpreterMutex> lock(mutex);
+                auto itr = std::stable_partition(retired.begin(), retired.end(),
+                                                 [oldest](Retired const& item) { return item.epoch >= oldest; });
+
+                expired.assign(itr, retired.end());
+                retired.erase(itr, retired.end());
+                retiredCount.store(retired.size(), std::memory_order_relaxed);
+            }
+
+            if (expired.empty())
+                return;
+
+            GILGuard gil;
+            for (Retired const& item : expired)
+            {
+                DestroyHolders(item.proxy, item.holders);
+                Py_DECREF(item.proxy);
+            }
+#endif
+        }
+
+        /**
+         * @brief Checks if the object notifies its removal from the world
+         *
+         * Only those objects are cached. Pets are not: Pet::RemoveFromWorld
+         * bypasses Creature::RemoveFromWorld, so no script hears about it.
+         */
+        static bool IsTracked(ObjectGuid guid) noexcept
+        {
+            return guid.IsPlayer() || guid.IsCreatureOrVehicle() || guid.IsGameObject();
+        }
+
+    private:
+        ProxyCache() = delete;
+
+        struct Entry
+        {
+            void const* address; // object the proxy points to
+            PyObject* proxy;     // owned reference
+        };
+
+        /**
+         * @brief Destroys a chain of instance holders of the proxy (GIL required)
+         *
+         * Same teardown as Boost.Python's instance deallocation.
+         */
+        static void DestroyHolders(PyObject* proxy, boost::python::instance_holder* holders)
+        {
+            using boost::python::instance_holder;
+
+            for (instance_holder *holder = holders, *next; holder; holder = next)
+            {
+                next = holder->next();
+                holder->~instance_holder();
+                instance_holder::deallocate(proxy, dynamic_cast<void*>(holder));
+            }
+        }
+
+        /**
+         * @brief Neuters proxy and drops the cache reference (GIL required)
+         *
+         * Once detached from its holders, the proxy no longer converts to a
+         * C++ pointer, so any method call raises a Python ArgumentError.
+         *
+         * With the GIL, no method of the proxy can be running meanwhile. A
+         * free-threaded build can't tell: a script on another map thread may
+         * be inside one, using the holder. The holders are then retired with
+         * the current epoch and destroyed by CollectRetired() once every
+         * dispatch open at this point has ended.
+         */
+        static void Release(PyObject* proxy)
+        {
+            auto* instance = reinterpret_cast<boost::python::objects::instance<>*>(proxy);
+            boost::python::instance_holder* holders = instance->objects;
+            instance->objects = nullptr;
+
+#ifdef Py_GIL_DISABLED
+            std::lock_guard<InterpreterMutex> lock(mutex);
+            retired.push_back(Retired{Utilities::EpochDomain::Advance(), proxy, holders});
+            retiredCount.store(retired.size(), std::memory_order_relaxed);
+#else
+            DestroyHolders(proxy, holders);
+            Py_DECREF(proxy);
+#endif
+        }
+
+        inline static InterpreterMutex mutex; // Get() allocates the proxy under the lock
+        inline static std::atomic<std::size_t> count{0};
+        inline static std::unordered_map<uint64, Entry> proxies;
+
+#ifdef Py_GIL_DISABLED
+        struct Retired
+        {
+            uint64 epoch;    // closed when the proxy was neutered
+            PyObject* proxy; // owned reference
+            boost::python::instance_holder* holders;
+        };
+
+        inline static std::vector<Retired> retired; // guarded by mutex
+        inline static std::atomic<std::size_t> retiredCount{0};
+#endif
+    };
+
+} // namespace PyEng::Bridge
+
+#endif // MOD_PYTHON_ENGINE_PROXY_CACHE_H
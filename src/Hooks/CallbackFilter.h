@@ -0,0 +1,129 @@
+#ifndef MOD_PYTHON_ENGINE_CALLBACK_FILTER_H
+#define MOD_PYTHON_ENGINE_CALLBACK_FILTER_H
+
+#include "Define.h"
+#include <type_traits>
+
+class Player;
+
+namespace PyEng::Hooks
+{
+    /**
+     * @brief Checks if hooks with these arguments can be filtered (first one is the player)
+     */
+    template<typename... Args>
+    inline constexpr bool HasFilterSubject = false;
+
+    template<typename First, typename... Rest>
+    inline constexpr bool HasFilterSubject<First, Rest...> = std::is_same_v<std::decay_t<First>, ::Player*>;
+
+    /**
+     * @brief Player fields tested by callback filters, read once per dispatch
+     */
+    struct FilterSubject
+    {
+        bool valid = false; // false if the hook has no player argument or it is null
+        uint32 mapId = 0;
+        uint32 zoneId = 0;
+        uint32 areaId = 0;
+        uint8 level = 0;
+        uint8 classId = 0;
+        uint8 raceId = 0;
+        uint8 teamId = 0;
+        bool inCombat = false;
+        bool gameMaster = false;
+
+        /**
+         * @brief Reads the subject from the first hook argument
+         */
+        template<typename First, typename... Rest>
+        static FilterSubject Of(First const& first, Rest const&...)
+        {
+            if constexpr (HasFilterSubject<First>)
+                return first ? Read(first) : FilterSubject{};
+            else
+                return FilterSubject{};
+        }
+
+    private:
+        // Template: Player is complete where hooks are triggered only
+        template<typename T>
+        static FilterSubject Read(T const* player)
+        {
+            FilterSubject subject;
+            subject.valid = true;
+            subject.mapId = player->GetMapId();
+            subject.zoneId = player->GetZoneId();
+            subject.areaId = player->GetAreaId();
+            subject.level = player->GetLevel();
+            subject.classId = player->getClass();
+            subject.raceId = player->getRace();
+            subject.teamId = static_cast<uint8>(player->GetTeamId());
+            subject.inCombat = player->IsInCombat();
+            subject.gameMaster = player->IsGameMaster();
+            return subject;
+        }
+    };
+
+    /**
+     * @brief Registration scope and guards of a callback
+     *
+     * Tested against the player argument before the GIL is taken, so events
+     * the callback would discard never reach Python. Only the fields set in
+     * mask are compared (0 is a valid map id and team).
+     */
+    struct CallbackFilter
+    {
+        enum Field : uint16
+        {
+            FIELD_MAP    = 0x001,
+            FIELD_ZONE   = 0x002,
+            FIELD_AREA   = 0x004,
+            FIELD_LEVEL  = 0x008, // minLevel <= level <= maxLevel
+            FIELD_CLASS  = 0x010,
+            FIELD_RACE   = 0x020,
+            FIELD_TEAM   = 0x040,
+            FIELD_COMBAT = 0x080,
+            FIELD_GM     = 0x100,
+        };
+
+        uint16 mask = 0;
+        uint32 mapId = 0;
+        uint32 zoneId = 0;
+        uint32 areaId = 0;
+        uint8 minLevel = 0;
+        uint8 maxLevel = 255;
+        uint32 classMask = 0; // bit per class id
+        uint32 raceMask = 0;  // bit per race id
+        uint8 teamId = 0;
+        bool inCombat = false;
+        bool gameMaster = false;
+
+        [[nodiscard]] bool IsEmpty() const noexcept { return mask == 0; }
+
+        /**
+         * @brief Checks if the dispatch is in scope (always true without filter)
+         */
+        [[nodiscard]] bool Matches(FilterSubject const& subject) const noexcept
+        {
+            if (IsEmpty())
+                return true;
+
+            if (!subject.valid)
+                return false;
+
+            return (!(mask & FIELD_MAP) || mapId == subject.mapId) &&
+                   (!(mask & FIELD_ZONE) || zoneId == subject.zoneId) &&
+                   (!(mask & FIELD_AREA) || areaId == subject.areaId) &&
+                   (!(mask & FIELD_LEVEL) || (subject.level >= minLevel && subject.level <= maxLevel)) &&
+                   (!(mask & FIELD_CLASS) || (classMask & (1u << subject.classId))) &&
+                   (!(mask & FIELD_RACE) || (raceMask & (1u << subject.raceId))) &&
+                   (!(mask & FIELD_TEAM) || teamId == subject.teamId) &&
+                   (!(mask & FIELD_COMBAT) || inCombat == subject.inCombat) &&
+                   (!(mask & FIELD_GM) || gameMaster == subject.gameMaster);
+        }
+    };
+
+} // namespace PyEng::Hooks
+
+#endif // MOD_PYTHON_ENGINE_CALLBACK_FILTER_H
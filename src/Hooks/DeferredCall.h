@@ -0,0 +1,179 @@
+#ifndef MOD_PYTHON_ENGINE_DEFERRED_CALL_H
+#define MOD_PYTHON_ENGINE_DEFERRED_CALL_H
+
+#include "HookInfo.h"
+#include "ObjectGuid.h"
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+class Creature;
+class GameObject;
+class Item;
+class Player;
+class Unit;
+class WorldObject;
+
+namespace PyEng::Hooks
+{
+    /**
+     * @brief Location of a world object captured for deferred dispatch
+     *
+     * Converted to an ObjectHandle when the call is dispatched.
+     */
+    struct DeferredObject
+    {
+        ObjectGuid guid;
+        uint32 mapId = 0;
+        uint32 instanceId = 0;
+    };
+
+    /**
+     * @brief Value snapshot of a hook argument
+     *
+     * Supported arguments are captured by value on the triggering thread, so
+     * async callbacks never see a raw pointer. Numbers and enums are copied,
+     * world objects become DeferredObject and items their ObjectGuid.
+     * References (by-ref arguments) and other pointers are not supported,
+     * hooks using them stay synchronous.
+     *
+     * @tparam T Declared C++ argument type
+     */
+    template<typename T>
+    struct DeferredValue
+    {
+        static constexpr bool Supported = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+        using Type = T;
+
+        static Type Capture(T value) noexcept { return value; }
+    };
+
+    template<>
+    struct DeferredValue<ObjectGuid>
+    {
+        static constexpr bool Supported = true;
+
+        using Type = ObjectGuid;
+
+        static Type Capture(ObjectGuid guid) noexcept { return guid; }
+    };
+
+    namespace Detail
+    {
+        struct DeferredWorldObject
+        {
+            static constexpr bool Supported = true;
+
+            using Type = DeferredObject;
+
+            // Template: the game class is only complete at the trigger site
+            template<typename T>
+            static Type Capture(T* object)
+            {
+                if (!object)
+                    return Type();
+
+                return Type{object->GetGUID(), object->GetMapId(), object->GetInstanceId()};
+            }
+        };
+
+    } // namespace Detail
+
+    template<>
+    struct DeferredValue<::WorldObject*> : Detail::DeferredWorldObject
+    {
+    };
+
+    template<>
+    struct DeferredValue<::Unit*> : Detail::DeferredWorldObject
+    {
+    };
+
+    template<>
+    struct DeferredValue<::Player*> : Detail::DeferredWorldObject
+    {
+    };
+
+    template<>
+    struct DeferredValue<::Creature*> : Detail::DeferredWorldObject
+    {
+    };
+
+    template<>
+    struct DeferredValue<::GameObject*> : Detail::DeferredWorldObject
+    {
+    };
+
+    template<>
+    struct DeferredValue<::Item*>
+    {
+        static constexpr bool Supported = true;
+
+        using Type = ObjectGuid;
+
+        template<typename T>
+        static Type Capture(T* item)
+        {
+            return item ? item->GetGUID() : ObjectGuid::Empty;
+        }
+    };
+
+    /**
+     * @brief Hook call captured for dispatch at the next world update
+     *
+     * Holds the hook, entry and a tuple of DeferredValue types in inline
+     * storage (no allocation per event). The dispatch function is
+     * instantiated per tuple type and restores the typed values.
+     */
+    class DeferredCall
+    {
+    public:
+        static constexpr std::size_t STORAGE_SIZE = 64;
+
+        /**
+         * @brief Dispatch function (context: engine that queued the call)
+         */
+        using DispatchFunction = void (*)(void* context, DeferredCall const& call);
+
+        template<typename Values>
+        DeferredCall(HookInfo hinfo, uint32 entryId, uint32 generation, DispatchFunction dispatch, Values&& values)
+            : hinfo(hinfo), entryId(entryId), generation(generation), dispatch(dispatch)
+        {
+            using Stored = std::decay_t<Values>;
+            static_assert(sizeof(Stored) <= STORAGE_SIZE, "Deferred hook arguments exceed STORAGE_SIZE");
+            static_assert(std::is_trivially_destructible_v<Stored>, "Deferred hook arguments are never destroyed");
+
+            new (storage) Stored(std::forward<Values>(values));
+        }
+
+        DeferredCall(DeferredCall const&) = delete;
+        DeferredCall& operator=(DeferredCall const&) = delete;
+
+        [[nodiscard]] HookInfo GetHook() const noexcept { return hinfo; }
+        [[nodiscard]] uint32 GetEntry() const noexcept { return entryId; }
+        [[nodiscard]] uint32 GetGeneration() const noexcept { return generation; }
+
+        /**
+         * @brief Captured values (Values must match the queued tuple type)
+         */
+        template<typename Values>
+        [[nodiscard]] Values const& GetValues() const noexcept
+        {
+            return *std::launder(reinterpret_cast<Values const*>(storage));
+        }
+
+        void Dispatch(void* context) const { dispatch(context, *this); }
+
+    private:
+        HookInfo hinfo;
+        uint32 entryId;
+        uint32 generation; // registry generation at capture time
+        DispatchFunction dispatch;
+        alignas(std::max_align_t) unsigned char storage[STORAGE_SIZE];
+    };
+
+} // namespace PyEng::Hooks
+
+#endif // MOD_PYTHON_ENGINE_DEFERRED_CALL_H
@@ -3,19 +3,25 @@
 
 #include "HookRegistry.h"
 
+/**
+ * @brief Account hook list: HOOK(Category, Name, Id, (Type, name)...)
+ */
+#define PYENG_ACCOUNT_HOOKS(HOOK) \
+    HOOK(ACCOUNT, ON_ACCOUNT_LOGIN, 0, (uint32, accountId)) \
+    HOOK(ACCOUNT, ON_BEFORE_ACCOUNT_DELETE, 1) \
+    HOOK(ACCOUNT, ON_LAST_IP_UPDATE, 2) \
+    HOOK(ACCOUNT, ON_FAILED_ACCOUNT_LOGIN, 3, (uint32, accountId)) \
+    HOOK(ACCOUNT, ON_EMAIL_CHANGE, 4) \
+    HOOK(ACCOUNT, ON_FAILED_EMAIL_CHANGE, 5) \
+    HOOK(ACCOUNT, ON_PASSWORD_CHANGE, 6) \
+    HOOK(ACCOUNT, ON_FAILED_PASSWORD_CHANGE, 7) \
+    HOOK(ACCOUNT, CAN_ACCOUNT_CREATE_CHARACTER, 8)
+
 namespace PyEng::Hooks
 {
     namespace Account
     {
-        DEFINE_GAME_HOOK(ACCOUNT, ON_ACCOUNT_LOGIN, 0)
-        DEFINE_GAME_HOOK(ACCOUNT, ON_BEFORE_ACCOUNT_DELETE, 1)
-        DEFINE_GAME_HOOK(ACCOUNT, ON_LAST_IP_UPDATE, 2)
-        DEFINE_GAME_HOOK(ACCOUNT, ON_FAILED_ACCOUNT_LOGIN, 3)
-        DEFINE_GAME_HOOK(ACCOUNT, ON_EMAIL_CHANGE, 4)
-        DEFINE_GAME_HOOK(ACCOUNT, ON_FAILED_EMAIL_CHANGE, 5)
-        DEFINE_GAME_HOOK(ACCOUNT, ON_PASSWORD_CHANGE, 6)
-        DEFINE_GAME_HOOK(ACCOUNT, ON_FAILED_PASSWORD_CHANGE, 7)
-        DEFINE_GAME_HOOK(ACCOUNT, CAN_ACCOUNT_CREATE_CHARACTER, 8)
+        PYENG_ACCOUNT_HOOKS(DEFINE_GAME_HOOK)
     }
 
 } // namespace PyEng::Hooks
@@ -3,15 +3,21 @@
 
 #include "HookRegistry.h"
 
+/**
+ * @brief Achievement hook list: HOOK(Category, Name, Id, (Type, name)...)
+ */
+#define PYENG_ACHIEVEMENT_HOOKS(HOOK) \
+    HOOK(ACHIEVEMENT, SET_REALM_COMPLETED, 0) \
+    HOOK(ACHIEVEMENT, IS_COMPLETED_CRITERIA, 1) \
+    HOOK(ACHIEVEMENT, IS_REALM_COMPLETED, 2) \
+    HOOK(ACHIEVEMENT, ON_BEFORE_CHECK_CRITERIA, 3) \
+    HOOK(ACHIEVEMENT, CAN_CHECK_CRITERIA, 4)
+
 namespace PyEng::Hooks
 {
     namespace Achievement
     {
-        DEFINE_GAME_HOOK(ACHIEVEMENT, SET_REALM_COMPLETED, 0)
-        DEFINE_GAME_HOOK(ACHIEVEMENT, IS_COMPLETED_CRITERIA, 1)
-        DEFINE_GAME_HOOK(ACHIEVEMENT, IS_REALM_COMPLETED, 2)
-        DEFINE_GAME_HOOK(ACHIEVEMENT, ON_BEFORE_CHECK_CRITERIA, 3)
-        DEFINE_GAME_HOOK(ACHIEVEMENT, CAN_CHECK_CRITERIA, 4)
+        PYENG_ACHIEVEMENT_HOOKS(DEFINE_GAME_HOOK)
     }
 
 } // namespace PyEng::Hooks
@@ -3,19 +3,32 @@
 
 #include "HookRegistry.h"
 
+class Creature;
+class Player;
+class Quest;
+
+/**
+ * @brief Creature hook list: HOOK(Category, Name, Id, (Type, name)...)
+ */
+#define PYENG_CREATURE_HOOKS(HOOK) \
+    HOOK(CREATURE, ON_GOSSIP_HELLO, 0, (::Player*, player), (::Creature*, creature)) \
+    HOOK(CREATURE, ON_GOSSIP_SELECT, 1, (::Player*, player), (::Creature*, creature), (uint32, sender), \
+         (uint32, action)) \
+    HOOK(CREATURE, ON_GOSSIP_SELECT_CODE, 2, (::Player*, player), (::Creature*, creature), (uint32, sender), \
+         (uint32, action), (char const*, code)) \
+    HOOK(CREATURE, ON_QUEST_ACCEPT, 3, (::Player*, player), (::Creature*, creature), (::Quest const*, quest)) \
+    HOOK(CREATURE, ON_QUEST_SELECT, 4, (::Player*, player), (::Creature*, creature), (::Quest const*, quest)) \
+    HOOK(CREATURE, ON_QUEST_COMPLETE, 5, (::Player*, player), (::Creature*, creature), (::Quest const*, quest)) \
+    HOOK(CREATURE, ON_QUEST_REWARD, 6, (::Player*, player), (::Creature*, creature), (::Quest const*, quest), \
+         (uint32, opt)) \
+    HOOK(CREATURE, ON_ADD_WORLD, 7, (::Creature*, creature)) \
+    HOOK(CREATURE, ON_REMOVE_WORLD, 8, (::Creature*, creature))
+
 namespace PyEng::Hooks
 {
     namespace Creature
     {
-        DEFINE_GAME_HOOK(CREATURE, ON_GOSSIP_HELLO, 0)
-        DEFINE_GAME_HOOK(CREATURE, ON_GOSSIP_SELECT, 1)
-        DEFINE_GAME_HOOK(CREATURE, ON_GOSSIP_SELECT_CODE, 2)
-        DEFINE_GAME_HOOK(CREATURE, ON_QUEST_ACCEPT, 3)
-        DEFINE_GAME_HOOK(CREATURE, ON_QUEST_SELECT, 4)
-        DEFINE_GAME_HOOK(CREATURE, ON_QUEST_COMPLETE, 5)
-        DEFINE_GAME_HOOK(CREATURE, ON_QUEST_REWARD, 6)
-        DEFINE_GAME_HOOK(CREATURE, ON_ADD_WORLD, 7)
-        DEFINE_GAME_HOOK(CREATURE, ON_REMOVE_WORLD, 8)
+        PYENG_CREATURE_HOOKS(DEFINE_GAME_HOOK)
     }
 
 } // namespace PyEng::Hooks
@@ -3,22 +3,32 @@
 
 #include "HookRegistry.h"
 
+class GameObject;
+class Player;
+
+/**
+ * @brief GameObject hook list: HOOK(Category, Name, Id, (Type, name)...)
+ */
+#define PYENG_GAMEOBJECT_HOOKS(HOOK) \
+    HOOK(GAMEOBJECT, ON_GOSSIP_HELLO, 0, (::Player*, player), (::GameObject*, go)) \
+    HOOK(GAMEOBJECT, ON_GOSSIP_SELECT, 1, (::Player*, player), (::GameObject*, go), (uint32, sender), \
+         (uint32, action)) \
+    HOOK(GAMEOBJECT, ON_GOSSIP_SELECT_CODE, 2) \
+    HOOK(GAMEOBJECT, ON_QUEST_ACCEPT, 3) \
+    HOOK(GAMEOBJECT, ON_QUEST_REWARD, 4) \
+    HOOK(GAMEOBJECT, ON_DESTROYED, 5, (::GameObject*, go), (::Player*, player)) \
+    HOOK(GAMEOBJECT, ON_DAMAGED, 6, (::GameObject*, go), (::Player*, player)) \
+    HOOK(GAMEOBJECT, ON_MODIFY_HEALTH, 7) \
+    HOOK(GAMEOBJECT, ON_LOOT_STATE_CHANGED, 8) \
+    HOOK(GAMEOBJECT, ON_UPDATE, 9) \
+    HOOK(GAMEOBJECT, ON_ADD_WORLD, 10, (::GameObject*, go)) \
+    HOOK(GAMEOBJECT, ON_REMOVE_WORLD, 11, (::GameObject*, go))
+
 namespace PyEng::Hooks
 {
     namespace GameObject
     {
-        DEFINE_GAME_HOOK(GAMEOBJECT, ON_GOSSIP_HELLO, 0)
-        DEFINE_GAME_HOOK(GAMEOBJECT, ON_GOSSIP_SELECT, 1)
-        DEFINE_GAME_HOOK(GAMEOBJECT, ON_GOSSIP_SELECT_CODE, 2)
-        DEFINE_GAME_HOOK(GAMEOBJECT, ON_QUEST_ACCEPT, 3)
-        DEFINE_GAME_HOOK(GAMEOBJECT, ON_QUEST_REWARD, 4)
-        DEFINE_GAME_HOOK(GAMEOBJECT, ON_DESTROYED, 5)
-        DEFINE_GAME_HOOK(GAMEOBJECT, ON_DAMAGED, 6)
-        DEFINE_GAME_HOOK(GAMEOBJECT, ON_MODIFY_HEALTH, 7)
-        DEFINE_GAME_HOOK(GAMEOBJECT, ON_LOOT_STATE_CHANGED, 8)
-        DEFINE_GAME_HOOK(GAMEOBJECT, ON_UPDATE, 9)
-        DEFINE_GAME_HOOK(GAMEOBJECT, ON_ADD_WORLD, 10)
-        DEFINE_GAME_HOOK(GAMEOBJECT, ON_REMOVE_WORLD, 11)
+        PYENG_GAMEOBJECT_HOOKS(DEFINE_GAME_HOOK)
     }
 
 } // namespace PyEng::Hooks
@@ -3,17 +3,33 @@
 
 #include "HookRegistry.h"
 
+class Item;
+class Player;
+class Quest;
+class SpellCastTargets;
+class SpellInfo;
+class Unit;
+struct ItemTemplate;
+
+/**
+ * @brief Item hook list: HOOK(Category, Name, Id, (Type, name)...)
+ */
+#define PYENG_ITEM_HOOKS(HOOK) \
+    HOOK(ITEM, ON_QUEST_ACCEPT, 0, (::Player*, player), (::Item*, item), (::Quest const*, quest)) \
+    HOOK(ITEM, ON_USE, 1, (::Player*, player), (::Item*, item), (::SpellCastTargets const&, targets)) \
+    HOOK(ITEM, ON_EXPIRE, 2, (::Player*, player), (::ItemTemplate const*, proto)) \
+    HOOK(ITEM, ON_REMOVE, 3, (::Player*, player), (::Item*, item)) \
+    HOOK(ITEM, ON_CAST_COMBAT_SPELL, 4, (::Player*, player), (::Unit*, victim), (::SpellInfo const*, spellInfo), \
+         (::Item*, item)) \
+    HOOK(ITEM, ON_GOSSIPE_SELECT, 5, (::Player*, player), (::Item*, item), (uint32, sender), (uint32, action)) \
+    HOOK(ITEM, ON_GOSSIPE_SELECT_CODE, 6, (::Player*, player), (::Item*, item), (uint32, sender), \
+         (uint32, action), (char const*, code))
+
 namespace PyEng::Hooks
 {
     namespace Item
     {
-        DEFINE_GAME_HOOK(ITEM, ON_QUEST_ACCEPT, 0)
-        DEFINE_GAME_HOOK(ITEM, ON_USE, 1)
-        DEFINE_GAME_HOOK(ITEM, ON_EXPIRE, 2)
-        DEFINE_GAME_HOOK(ITEM, ON_REMOVE, 3)
-        DEFINE_GAME_HOOK(ITEM, ON_CAST_COMBAT_SPELL, 4)
-        DEFINE_GAME_HOOK(ITEM, ON_GOSSIPE_SELECT, 5)
-        DEFINE_GAME_HOOK(ITEM, ON_GOSSIPE_SELECT_CODE, 6)
+        PYENG_ITEM_HOOKS(DEFINE_GAME_HOOK)
     }
 
 } // namespace PyEng::Hooks
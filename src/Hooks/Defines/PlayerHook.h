@@ -2,189 +2,206 @@
 #define MOD_PYTHON_ENGINE_PLAYER_HOOK_H
 
 #include "HookRegistry.h"
+#include <string>
+
+class Item;
+class ObjectGuid;
+class Player;
+class SpellCastTargets;
+class SpellInfo;
+class Unit;
+
+/**
+ * @brief Player hook list: HOOK(Category, Name, Id, (Type, name)...)
+ */
+#define PYENG_PLAYER_HOOKS(HOOK) \
+    HOOK(PLAYER, ON_PLAYER_JUST_DIED, 0) \
+    HOOK(PLAYER, ON_CALCULATE_TALENTS_POINTS, 1) \
+    HOOK(PLAYER, ON_PLAYER_RELEASED_GHOST, 2) \
+    HOOK(PLAYER, ON_SEND_INITIAL_PACKETS_BEFORE_ADD_TO_MAP, 3) \
+    HOOK(PLAYER, ON_BATTLEGROUND_DESERTION, 4) \
+    HOOK(PLAYER, ON_PLAYER_COMPLETE_QUEST, 5) \
+    HOOK(PLAYER, ON_PVP_KILL, 6, (::Player*, killer), (::Player*, killed)) \
+    HOOK(PLAYER, ON_PLAYER_PVP_FLAG_CHANGE, 7) \
+    HOOK(PLAYER, ON_CREATURE_KILL, 8) \
+    HOOK(PLAYER, ON_CREATURE_KILLED_BY_PET, 9) \
+    HOOK(PLAYER, ON_PLAYER_KILLED_BY_CREATURE, 10) \
+    HOOK(PLAYER, ON_LEVEL_CHANGED, 11, (::Player*, player), (uint8, oldLevel)) \
+    HOOK(PLAYER, ON_FREE_TALENT_POINTS_CHANGED, 12) \
+    HOOK(PLAYER, ON_TALENTS_RESET, 13) \
+    HOOK(PLAYER, ON_AFTER_SPEC_SLOT_CHANGED, 14) \
+    HOOK(PLAYER, ON_BEFORE_UPDATE, 15) \
+    HOOK(PLAYER, ON_UPDATE, 16, (::Player*, player), (uint32, diff)) \
+    HOOK(PLAYER, ON_MONEY_CHANGED, 17, (::Player*, player), (int32&, amount)) \
+    HOOK(PLAYER, ON_BEFORE_LOOT_MONEY, 18) \
+    HOOK(PLAYER, ON_GIVE_EXP, 19, (::Player*, player), (uint32&, amount), (::Unit*, victim), (uint8, xpSource)) \
+    HOOK(PLAYER, ON_REPUTATION_CHANGE, 20) \
+    HOOK(PLAYER, ON_REPUTATION_RANK_CHANGE, 21) \
+    HOOK(PLAYER, ON_LEARN_SPELL, 22) \
+    HOOK(PLAYER, ON_FORGOT_SPELL, 23) \
+    HOOK(PLAYER, ON_DUEL_REQUEST, 24) \
+    HOOK(PLAYER, ON_DUEL_START, 25) \
+    HOOK(PLAYER, ON_DUEL_END, 26) \
+    HOOK(PLAYER, ON_BEFORE_SEND_CHAT_MESSAGE, 27) \
+    HOOK(PLAYER, ON_EMOTE, 28) \
+    HOOK(PLAYER, ON_TEXT_EMOTE, 29) \
+    HOOK(PLAYER, ON_SPELL_CAST, 30, (::Player*, player), (::SpellInfo const*, spellInfo), \
+         (::SpellCastTargets const*, targets), (bool, skipCheck)) \
+    HOOK(PLAYER, ON_LOAD_FROM_DB, 31) \
+    HOOK(PLAYER, ON_LOGIN, 32, (::Player*, player)) \
+    HOOK(PLAYER, ON_BEFORE_LOGOUT, 33) \
+    HOOK(PLAYER, ON_LOGOUT, 34, (::Player*, player)) \
+    HOOK(PLAYER, ON_CREATE, 35) \
+    HOOK(PLAYER, ON_DELETE, 36) \
+    HOOK(PLAYER, ON_FAILED_DELETE, 37) \
+    HOOK(PLAYER, ON_SAVE, 38) \
+    HOOK(PLAYER, ON_BIND_TO_INSTANCE, 39) \
+    HOOK(PLAYER, ON_UPDATE_ZONE, 40) \
+    HOOK(PLAYER, ON_UPDATE_AREA, 41) \
+    HOOK(PLAYER, ON_MAP_CHANGED, 42) \
+    HOOK(PLAYER, ON_BEFORE_TELEPORT, 43) \
+    HOOK(PLAYER, ON_UPDATE_FACTION, 44) \
+    HOOK(PLAYER, ON_ADD_TO_BATTLEGROUND, 45) \
+    HOOK(PLAYER, ON_QUEUE_RANDOM_DUNGEON, 46) \
+    HOOK(PLAYER, ON_REMOVE_FROM_BATTLEGROUND, 47) \
+    HOOK(PLAYER, ON_ACHI_COMPLETE, 48) \
+    HOOK(PLAYER, ON_BEFORE_ACHI_COMPLETE, 49) \
+    HOOK(PLAYER, ON_CRITERIA_PROGRESS, 50) \
+    HOOK(PLAYER, ON_BEFORE_CRITERIA_PROGRESS, 51) \
+    HOOK(PLAYER, ON_ACHI_SAVE, 52) \
+    HOOK(PLAYER, ON_CRITERIA_SAVE, 53) \
+    HOOK(PLAYER, ON_GOSSIP_SELECT, 54) \
+    HOOK(PLAYER, ON_GOSSIP_SELECT_CODE, 55) \
+    HOOK(PLAYER, ON_BEING_CHARMED, 56) \
+    HOOK(PLAYER, ON_AFTER_SET_VISIBLE_ITEM_SLOT, 57) \
+    HOOK(PLAYER, ON_AFTER_MOVE_ITEM_FROM_INVENTORY, 58) \
+    HOOK(PLAYER, ON_EQUIP, 59) \
+    HOOK(PLAYER, ON_PLAYER_JOIN_BG, 60) \
+    HOOK(PLAYER, ON_PLAYER_JOIN_ARENA, 61) \
+    HOOK(PLAYER, GET_CUSTOM_GET_ARENA_TEAM_ID, 62) \
+    HOOK(PLAYER, GET_CUSTOM_ARENA_PERSONAL_RATING, 63) \
+    HOOK(PLAYER, ON_GET_MAX_PERSONAL_ARENA_RATING_REQUIREMENT, 64) \
+    HOOK(PLAYER, ON_LOOT_ITEM, 65, (::Player*, player), (::Item*, item), (uint32, count), (::ObjectGuid, lootguid)) \
+    HOOK(PLAYER, ON_BEFORE_FILL_QUEST_LOOT_ITEM, 66) \
+    HOOK(PLAYER, ON_STORE_NEW_ITEM, 67) \
+    HOOK(PLAYER, ON_CREATE_ITEM, 68) \
+    HOOK(PLAYER, ON_QUEST_REWARD_ITEM, 69) \
+    HOOK(PLAYER, CAN_PLACE_AUCTION_BID, 70) \
+    HOOK(PLAYER, ON_GROUP_ROLL_REWARD_ITEM, 71) \
+    HOOK(PLAYER, ON_BEFORE_OPEN_ITEM, 72) \
+    HOOK(PLAYER, ON_BEFORE_QUEST_COMPLETE, 73) \
+    HOOK(PLAYER, ON_QUEST_COMPUTE_EXP, 74) \
+    HOOK(PLAYER, ON_BEFORE_DURABILITY_REPAIR, 75) \
+    HOOK(PLAYER, ON_BEFORE_BUY_ITEM_FROM_VENDOR, 76) \
+    HOOK(PLAYER, ON_BEFORE_STORE_OR_EQUIP_NEW_ITEM, 77) \
+    HOOK(PLAYER, ON_AFTER_STORE_OR_EQUIP_NEW_ITEM, 78) \
+    HOOK(PLAYER, ON_AFTER_UPDATE_MAX_POWER, 79) \
+    HOOK(PLAYER, ON_AFTER_UPDATE_MAX_HEALTH, 80) \
+    HOOK(PLAYER, ON_BEFORE_UPDATE_ATTACK_POWER_AND_DAMAGE, 81) \
+    HOOK(PLAYER, ON_AFTER_UPDATE_ATTACK_POWER_AND_DAMAGE, 82) \
+    HOOK(PLAYER, ON_BEFORE_INIT_TALENT_FOR_LEVEL, 83) \
+    HOOK(PLAYER, ON_FIRST_LOGIN, 84) \
+    HOOK(PLAYER, ON_SET_MAX_LEVEL, 85) \
+    HOOK(PLAYER, CAN_JOIN_IN_BATTLEGROUND_QUEUE, 86) \
+    HOOK(PLAYER, SHOULD_BE_REWARDED_WITH_MONEY_INSTEAD_OF_EXP, 87) \
+    HOOK(PLAYER, ON_BEFORE_TEMP_SUMMON_INIT_STATS, 88) \
+    HOOK(PLAYER, ON_BEFORE_GUARDIAN_INIT_STATS_FOR_LEVEL, 89) \
+    HOOK(PLAYER, ON_AFTER_GUARDIAN_INIT_STATS_FOR_LEVEL, 90) \
+    HOOK(PLAYER, ON_BEFORE_LOAD_PET_FROM_DB, 91) \
+    HOOK(PLAYER, CAN_JOIN_IN_ARENA_QUEUE, 92) \
+    HOOK(PLAYER, CAN_BATTLEFIELD_PORT, 93) \
+    HOOK(PLAYER, CAN_GROUP_INVITE, 94) \
+    HOOK(PLAYER, CAN_GROUP_ACCEPT, 95) \
+    HOOK(PLAYER, CAN_SELL_ITEM, 96) \
+    HOOK(PLAYER, CAN_SEND_MAIL, 97) \
+    HOOK(PLAYER, PETITION_BUY, 98) \
+    HOOK(PLAYER, PETITION_SHOW_LIST, 99) \
+    HOOK(PLAYER, ON_REWARD_KILL_REWARDER, 100) \
+    HOOK(PLAYER, CAN_GIVE_MAIL_REWARD_AT_GIVE_LEVEL, 101) \
+    HOOK(PLAYER, ON_DELETE_FROM_DB, 102) \
+    HOOK(PLAYER, CAN_REPOP_AT_GRAVEYARD, 103) \
+    HOOK(PLAYER, ON_PLAYER_IS_CLASS, 104) \
+    HOOK(PLAYER, ON_GET_MAX_SKILL_VALUE, 105) \
+    HOOK(PLAYER, ON_PLAYER_HAS_ACTIVE_POWER_TYPE, 106) \
+    HOOK(PLAYER, ON_UPDATE_GATHERING_SKILL, 107) \
+    HOOK(PLAYER, ON_UPDATE_CRAFTING_SKILL, 108) \
+    HOOK(PLAYER, ON_UPDATE_FISHING_SKILL, 109) \
+    HOOK(PLAYER, CAN_AREA_EXPLORE_AND_OUTDOOR, 110) \
+    HOOK(PLAYER, ON_VICTIM_REWARD_BEFORE, 111) \
+    HOOK(PLAYER, ON_VICTIM_REWARD_AFTER, 112) \
+    HOOK(PLAYER, ON_CUSTOM_SCALING_STAT_VALUE_BEFORE, 113) \
+    HOOK(PLAYER, ON_CUSTOM_SCALING_STAT_VALUE, 114) \
+    HOOK(PLAYER, ON_APPLY_ITEM_MODS_BEFORE, 115) \
+    HOOK(PLAYER, ON_APPLY_ENCHANTMENT_ITEM_MODS_BEFORE, 116) \
+    HOOK(PLAYER, ON_APPLY_WEAPON_DAMAGE, 117) \
+    HOOK(PLAYER, CAN_ARMOR_DAMAGE_MODIFIER, 118) \
+    HOOK(PLAYER, ON_GET_FERAL_AP_BONUS, 119) \
+    HOOK(PLAYER, CAN_APPLY_WEAPON_DEPENDENT_AURA_DAMAGE_MOD, 120) \
+    HOOK(PLAYER, CAN_APPLY_EQUIP_SPELL, 121) \
+    HOOK(PLAYER, CAN_APPLY_EQUIP_SPELLS_ITEM_SET, 122) \
+    HOOK(PLAYER, CAN_CAST_ITEM_COMBAT_SPELL, 123) \
+    HOOK(PLAYER, CAN_CAST_ITEM_USE_SPELL, 124) \
+    HOOK(PLAYER, ON_APPLY_AMMO_BONUSES, 125) \
+    HOOK(PLAYER, CAN_EQUIP_ITEM, 126, (::Player*, player), (uint8, slot), (uint16&, dest), (::Item*, item), \
+         (bool, swap), (bool, notLoading)) \
+    HOOK(PLAYER, CAN_UNEQUIP_ITEM, 127) \
+    HOOK(PLAYER, CAN_USE_ITEM, 128) \
+    HOOK(PLAYER, CAN_SAVE_EQUIP_NEW_ITEM, 129) \
+    HOOK(PLAYER, CAN_APPLY_ENCHANTMENT, 130) \
+    HOOK(PLAYER, PASSED_QUEST_KILLED_MONSTER_CREDIT, 131) \
+    HOOK(PLAYER, CHECK_ITEM_IN_SLOT_AT_LOAD_INVENTORY, 132) \
+    HOOK(PLAYER, NOT_AVOID_SATISFY, 133) \
+    HOOK(PLAYER, NOT_VISIBLE_GLOBALLY_FOR, 134) \
+    HOOK(PLAYER, ON_GET_ARENA_PERSONAL_RATING, 135) \
+    HOOK(PLAYER, ON_GET_ARENA_TEAM_ID, 136) \
+    HOOK(PLAYER, ON_IS_FFA_PVP, 137) \
+    HOOK(PLAYER, ON_FFA_PVP_STATE_UPDATE, 138) \
+    HOOK(PLAYER, ON_IS_PVP, 139) \
+    HOOK(PLAYER, ON_GET_MAX_SKILL_VALUE_FOR_LEVEL, 140) \
+    HOOK(PLAYER, NOT_SET_ARENA_TEAM_INFO_FIELD, 141) \
+    HOOK(PLAYER, CAN_JOIN_LFG, 142) \
+    HOOK(PLAYER, CAN_ENTER_MAP, 143) \
+    HOOK(PLAYER, CAN_INIT_TRADE, 144) \
+    HOOK(PLAYER, CAN_SET_TRADE_ITEM, 145) \
+    HOOK(PLAYER, ON_SET_SERVER_SIDE_VISIBILITY, 146) \
+    HOOK(PLAYER, ON_SET_SERVER_SIDE_VISIBILITY_DETECT, 147) \
+    HOOK(PLAYER, ON_PLAYER_RESURRECT, 148) \
+    HOOK(PLAYER, ON_BEFORE_CHOOSE_GRAVEYARD, 149) \
+    HOOK(PLAYER, CAN_PLAYER_USE_CHAT, 150, (::Player*, player), (uint32, type), (uint32, language), \
+         (std::string&, msg)) \
+    HOOK(PLAYER, CAN_PLAYER_USE_PRIVATE_CHAT, 151) \
+    HOOK(PLAYER, CAN_PLAYER_USE_GROUP_CHAT, 152) \
+    HOOK(PLAYER, CAN_PLAYER_USE_GUILD_CHAT, 153) \
+    HOOK(PLAYER, CAN_PLAYER_USE_CHANNEL_CHAT, 154) \
+    HOOK(PLAYER, ON_PLAYER_LEARN_TALENTS, 155) \
+    HOOK(PLAYER, ON_PLAYER_ENTER_COMBAT, 156) \
+    HOOK(PLAYER, ON_PLAYER_LEAVE_COMBAT, 157) \
+    HOOK(PLAYER, ON_QUEST_ABANDON, 158) \
+    HOOK(PLAYER, ON_GET_QUEST_RATE, 159) \
+    HOOK(PLAYER, ON_CAN_PLAYER_FLY_IN_ZONE, 160) \
+    HOOK(PLAYER, ANTICHEAT_SET_CAN_FLY_BY_SERVER, 161) \
+    HOOK(PLAYER, ANTICHEAT_SET_UNDER_ACK_MOUNT, 162) \
+    HOOK(PLAYER, ANTICHEAT_SET_ROOT_ACK_UPD, 163) \
+    HOOK(PLAYER, ANTICHEAT_SET_JUMPING_BY_OPCODE, 164) \
+    HOOK(PLAYER, ANTICHEAT_UPDATE_MOVEMENT_INFO, 165) \
+    HOOK(PLAYER, ANTICHEAT_HANDLE_DOUBLE_JUMP, 166) \
+    HOOK(PLAYER, ANTICHEAT_CHECK_MOVEMENT_INFO, 167) \
+    HOOK(PLAYER, CAN_SEND_ERROR_ALREADY_LOOTED, 168) \
+    HOOK(PLAYER, ON_AFTER_CREATURE_LOOT, 169) \
+    HOOK(PLAYER, ON_AFTER_CREATURE_LOOT_MONEY, 170) \
+    HOOK(PLAYER, ON_CAN_UPDATE_SKILL, 171) \
+    HOOK(PLAYER, ON_BEFORE_UPDATE_SKILL, 172) \
+    HOOK(PLAYER, ON_UPDATE_SKILL, 173) \
+    HOOK(PLAYER, CAN_RESURRECT, 174) \
+    HOOK(PLAYER, ON_CAN_GIVE_LEVEL, 175) \
+    HOOK(PLAYER, ON_SEND_LIST_INVENTORY, 176) \
+    HOOK(PLAYER, ON_GIVE_REPUTATION, 177)
 
 namespace PyEng::Hooks
 {
     namespace Player
     {
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_JUST_DIED, 0)
-        DEFINE_GAME_HOOK(PLAYER, ON_CALCULATE_TALENTS_POINTS, 1)
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_RELEASED_GHOST, 2)
-        DEFINE_GAME_HOOK(PLAYER, ON_SEND_INITIAL_PACKETS_BEFORE_ADD_TO_MAP, 3)
-        DEFINE_GAME_HOOK(PLAYER, ON_BATTLEGROUND_DESERTION, 4)
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_COMPLETE_QUEST, 5)
-        DEFINE_GAME_HOOK(PLAYER, ON_PVP_KILL, 6)
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_PVP_FLAG_CHANGE, 7)
-        DEFINE_GAME_HOOK(PLAYER, ON_CREATURE_KILL, 8)
-        DEFINE_GAME_HOOK(PLAYER, ON_CREATURE_KILLED_BY_PET, 9)
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_KILLED_BY_CREATURE, 10)
-        DEFINE_GAME_HOOK(PLAYER, ON_LEVEL_CHANGED, 11)
-        DEFINE_GAME_HOOK(PLAYER, ON_FREE_TALENT_POINTS_CHANGED, 12)
-        DEFINE_GAME_HOOK(PLAYER, ON_TALENTS_RESET, 13)
-        DEFINE_GAME_HOOK(PLAYER, ON_AFTER_SPEC_SLOT_CHANGED, 14)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_UPDATE, 15)
-        DEFINE_GAME_HOOK(PLAYER, ON_UPDATE, 16)
-        DEFINE_GAME_HOOK(PLAYER, ON_MONEY_CHANGED, 17)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_LOOT_MONEY, 18)
-        DEFINE_GAME_HOOK(PLAYER, ON_GIVE_EXP, 19)
-        DEFINE_GAME_HOOK(PLAYER, ON_REPUTATION_CHANGE, 20)
-        DEFINE_GAME_HOOK(PLAYER, ON_REPUTATION_RANK_CHANGE, 21)
-        DEFINE_GAME_HOOK(PLAYER, ON_LEARN_SPELL, 22)
-        DEFINE_GAME_HOOK(PLAYER, ON_FORGOT_SPELL, 23)
-        DEFINE_GAME_HOOK(PLAYER, ON_DUEL_REQUEST, 24)
-        DEFINE_GAME_HOOK(PLAYER, ON_DUEL_START, 25)
-        DEFINE_GAME_HOOK(PLAYER, ON_DUEL_END, 26)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_SEND_CHAT_MESSAGE, 27)
-        DEFINE_GAME_HOOK(PLAYER, ON_EMOTE, 28)
-        DEFINE_GAME_HOOK(PLAYER, ON_TEXT_EMOTE, 29)
-        DEFINE_GAME_HOOK(PLAYER, ON_SPELL_CAST, 30)
-        DEFINE_GAME_HOOK(PLAYER, ON_LOAD_FROM_DB, 31)
-        DEFINE_GAME_HOOK(PLAYER, ON_LOGIN, 32)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_LOGOUT, 33)
-        DEFINE_GAME_HOOK(PLAYER, ON_LOGOUT, 34)
-        DEFINE_GAME_HOOK(PLAYER, ON_CREATE, 35)
-        DEFINE_GAME_HOOK(PLAYER, ON_DELETE, 36)
-        DEFINE_GAME_HOOK(PLAYER, ON_FAILED_DELETE, 37)
-        DEFINE_GAME_HOOK(PLAYER, ON_SAVE, 38)
-        DEFINE_GAME_HOOK(PLAYER, ON_BIND_TO_INSTANCE, 39)
-        DEFINE_GAME_HOOK(PLAYER, ON_UPDATE_ZONE, 40)
-        DEFINE_GAME_HOOK(PLAYER, ON_UPDATE_AREA, 41)
-        DEFINE_GAME_HOOK(PLAYER, ON_MAP_CHANGED, 42)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_TELEPORT, 43)
-        DEFINE_GAME_HOOK(PLAYER, ON_UPDATE_FACTION, 44)
-        DEFINE_GAME_HOOK(PLAYER, ON_ADD_TO_BATTLEGROUND, 45)
-        DEFINE_GAME_HOOK(PLAYER, ON_QUEUE_RANDOM_DUNGEON, 46)
-        DEFINE_GAME_HOOK(PLAYER, ON_REMOVE_FROM_BATTLEGROUND, 47)
-        DEFINE_GAME_HOOK(PLAYER, ON_ACHI_COMPLETE, 48)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_ACHI_COMPLETE, 49)
-        DEFINE_GAME_HOOK(PLAYER, ON_CRITERIA_PROGRESS, 50)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_CRITERIA_PROGRESS, 51)
-        DEFINE_GAME_HOOK(PLAYER, ON_ACHI_SAVE, 52)
-        DEFINE_GAME_HOOK(PLAYER, ON_CRITERIA_SAVE, 53)
-        DEFINE_GAME_HOOK(PLAYER, ON_GOSSIP_SELECT, 54)
-        DEFINE_GAME_HOOK(PLAYER, ON_GOSSIP_SELECT_CODE, 55)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEING_CHARMED, 56)
-        DEFINE_GAME_HOOK(PLAYER, ON_AFTER_SET_VISIBLE_ITEM_SLOT, 57)
-        DEFINE_GAME_HOOK(PLAYER, ON_AFTER_MOVE_ITEM_FROM_INVENTORY, 58)
-        DEFINE_GAME_HOOK(PLAYER, ON_EQUIP, 59)
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_JOIN_BG, 60)
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_JOIN_ARENA, 61)
-        DEFINE_GAME_HOOK(PLAYER, GET_CUSTOM_GET_ARENA_TEAM_ID, 62)
-        DEFINE_GAME_HOOK(PLAYER, GET_CUSTOM_ARENA_PERSONAL_RATING, 63)
-        DEFINE_GAME_HOOK(PLAYER, ON_GET_MAX_PERSONAL_ARENA_RATING_REQUIREMENT, 64)
-        DEFINE_GAME_HOOK(PLAYER, ON_LOOT_ITEM, 65)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_FILL_QUEST_LOOT_ITEM, 66)
-        DEFINE_GAME_HOOK(PLAYER, ON_STORE_NEW_ITEM, 67)
-        DEFINE_GAME_HOOK(PLAYER, ON_CREATE_ITEM, 68)
-        DEFINE_GAME_HOOK(PLAYER, ON_QUEST_REWARD_ITEM, 69)
-        DEFINE_GAME_HOOK(PLAYER, CAN_PLACE_AUCTION_BID, 70)
-        DEFINE_GAME_HOOK(PLAYER, ON_GROUP_ROLL_REWARD_ITEM, 71)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_OPEN_ITEM, 72)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_QUEST_COMPLETE, 73)
-        DEFINE_GAME_HOOK(PLAYER, ON_QUEST_COMPUTE_EXP, 74)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_DURABILITY_REPAIR, 75)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_BUY_ITEM_FROM_VENDOR, 76)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_STORE_OR_EQUIP_NEW_ITEM, 77)
-        DEFINE_GAME_HOOK(PLAYER, ON_AFTER_STORE_OR_EQUIP_NEW_ITEM, 78)
-        DEFINE_GAME_HOOK(PLAYER, ON_AFTER_UPDATE_MAX_POWER, 79)
-        DEFINE_GAME_HOOK(PLAYER, ON_AFTER_UPDATE_MAX_HEALTH, 80)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_UPDATE_ATTACK_POWER_AND_DAMAGE, 81)
-        DEFINE_GAME_HOOK(PLAYER, ON_AFTER_UPDATE_ATTACK_POWER_AND_DAMAGE, 82)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_INIT_TALENT_FOR_LEVEL, 83)
-        DEFINE_GAME_HOOK(PLAYER, ON_FIRST_LOGIN, 84)
-        DEFINE_GAME_HOOK(PLAYER, ON_SET_MAX_LEVEL, 85)
-        DEFINE_GAME_HOOK(PLAYER, CAN_JOIN_IN_BATTLEGROUND_QUEUE, 86)
-        DEFINE_GAME_HOOK(PLAYER, SHOULD_BE_REWARDED_WITH_MONEY_INSTEAD_OF_EXP, 87)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_TEMP_SUMMON_INIT_STATS, 88)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_GUARDIAN_INIT_STATS_FOR_LEVEL, 89)
-        DEFINE_GAME_HOOK(PLAYER, ON_AFTER_GUARDIAN_INIT_STATS_FOR_LEVEL, 90)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_LOAD_PET_FROM_DB, 91)
-        DEFINE_GAME_HOOK(PLAYER, CAN_JOIN_IN_ARENA_QUEUE, 92)
-        DEFINE_GAME_HOOK(PLAYER, CAN_BATTLEFIELD_PORT, 93)
-        DEFINE_GAME_HOOK(PLAYER, CAN_GROUP_INVITE, 94)
-        DEFINE_GAME_HOOK(PLAYER, CAN_GROUP_ACCEPT, 95)
-        DEFINE_GAME_HOOK(PLAYER, CAN_SELL_ITEM, 96)
-        DEFINE_GAME_HOOK(PLAYER, CAN_SEND_MAIL, 97)
-        DEFINE_GAME_HOOK(PLAYER, PETITION_BUY, 98)
-        DEFINE_GAME_HOOK(PLAYER, PETITION_SHOW_LIST, 99)
-        DEFINE_GAME_HOOK(PLAYER, ON_REWARD_KILL_REWARDER, 100)
-        DEFINE_GAME_HOOK(PLAYER, CAN_GIVE_MAIL_REWARD_AT_GIVE_LEVEL, 101)
-        DEFINE_GAME_HOOK(PLAYER, ON_DELETE_FROM_DB, 102)
-        DEFINE_GAME_HOOK(PLAYER, CAN_REPOP_AT_GRAVEYARD, 103)
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_IS_CLASS, 104)
-        DEFINE_GAME_HOOK(PLAYER, ON_GET_MAX_SKILL_VALUE, 105)
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_HAS_ACTIVE_POWER_TYPE, 106)
-        DEFINE_GAME_HOOK(PLAYER, ON_UPDATE_GATHERING_SKILL, 107)
-        DEFINE_GAME_HOOK(PLAYER, ON_UPDATE_CRAFTING_SKILL, 108)
-        DEFINE_GAME_HOOK(PLAYER, ON_UPDATE_FISHING_SKILL, 109)
-        DEFINE_GAME_HOOK(PLAYER, CAN_AREA_EXPLORE_AND_OUTDOOR, 110)
-        DEFINE_GAME_HOOK(PLAYER, ON_VICTIM_REWARD_BEFORE, 111)
-        DEFINE_GAME_HOOK(PLAYER, ON_VICTIM_REWARD_AFTER, 112)
-        DEFINE_GAME_HOOK(PLAYER, ON_CUSTOM_SCALING_STAT_VALUE_BEFORE, 113)
-        DEFINE_GAME_HOOK(PLAYER, ON_CUSTOM_SCALING_STAT_VALUE, 114)
-        DEFINE_GAME_HOOK(PLAYER, ON_APPLY_ITEM_MODS_BEFORE, 115)
-        DEFINE_GAME_HOOK(PLAYER, ON_APPLY_ENCHANTMENT_ITEM_MODS_BEFORE, 116)
-        DEFINE_GAME_HOOK(PLAYER, ON_APPLY_WEAPON_DAMAGE, 117)
-        DEFINE_GAME_HOOK(PLAYER, CAN_ARMOR_DAMAGE_MODIFIER, 118)
-        DEFINE_GAME_HOOK(PLAYER, ON_GET_FERAL_AP_BONUS, 119)
-        DEFINE_GAME_HOOK(PLAYER, CAN_APPLY_WEAPON_DEPENDENT_AURA_DAMAGE_MOD, 120)
-        DEFINE_GAME_HOOK(PLAYER, CAN_APPLY_EQUIP_SPELL, 121)
-        DEFINE_GAME_HOOK(PLAYER, CAN_APPLY_EQUIP_SPELLS_ITEM_SET, 122)
-        DEFINE_GAME_HOOK(PLAYER, CAN_CAST_ITEM_COMBAT_SPELL, 123)
-        DEFINE_GAME_HOOK(PLAYER, CAN_CAST_ITEM_USE_SPELL, 124)
-        DEFINE_GAME_HOOK(PLAYER, ON_APPLY_AMMO_BONUSES, 125)
-        DEFINE_GAME_HOOK(PLAYER, CAN_EQUIP_ITEM, 126)
-        DEFINE_GAME_HOOK(PLAYER, CAN_UNEQUIP_ITEM, 127)
-        DEFINE_GAME_HOOK(PLAYER, CAN_USE_ITEM, 128)
-        DEFINE_GAME_HOOK(PLAYER, CAN_SAVE_EQUIP_NEW_ITEM, 129)
-        DEFINE_GAME_HOOK(PLAYER, CAN_APPLY_ENCHANTMENT, 130)
-        DEFINE_GAME_HOOK(PLAYER, PASSED_QUEST_KILLED_MONSTER_CREDIT, 131)
-        DEFINE_GAME_HOOK(PLAYER, CHECK_ITEM_IN_SLOT_AT_LOAD_INVENTORY, 132)
-        DEFINE_GAME_HOOK(PLAYER, NOT_AVOID_SATISFY, 133)
-        DEFINE_GAME_HOOK(PLAYER, NOT_VISIBLE_GLOBALLY_FOR, 134)
-        DEFINE_GAME_HOOK(PLAYER, ON_GET_ARENA_PERSONAL_RATING, 135)
-        DEFINE_GAME_HOOK(PLAYER, ON_GET_ARENA_TEAM_ID, 136)
-        DEFINE_GAME_HOOK(PLAYER, ON_IS_FFA_PVP, 137)
-        DEFINE_GAME_HOOK(PLAYER, ON_FFA_PVP_STATE_UPDATE, 138)
-        DEFINE_GAME_HOOK(PLAYER, ON_IS_PVP, 139)
-        DEFINE_GAME_HOOK(PLAYER, ON_GET_MAX_SKILL_VALUE_FOR_LEVEL, 140)
-        DEFINE_GAME_HOOK(PLAYER, NOT_SET_ARENA_TEAM_INFO_FIELD, 141)
-        DEFINE_GAME_HOOK(PLAYER, CAN_JOIN_LFG, 142)
-        DEFINE_GAME_HOOK(PLAYER, CAN_ENTER_MAP, 143)
-        DEFINE_GAME_HOOK(PLAYER, CAN_INIT_TRADE, 144)
-        DEFINE_GAME_HOOK(PLAYER, CAN_SET_TRADE_ITEM, 145)
-        DEFINE_GAME_HOOK(PLAYER, ON_SET_SERVER_SIDE_VISIBILITY, 146)
-        DEFINE_GAME_HOOK(PLAYER, ON_SET_SERVER_SIDE_VISIBILITY_DETECT, 147)
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_RESURRECT, 148)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_CHOOSE_GRAVEYARD, 149)
-        DEFINE_GAME_HOOK(PLAYER, CAN_PLAYER_USE_CHAT, 150)
-        DEFINE_GAME_HOOK(PLAYER, CAN_PLAYER_USE_PRIVATE_CHAT, 151)
-        DEFINE_GAME_HOOK(PLAYER, CAN_PLAYER_USE_GROUP_CHAT, 152)
-        DEFINE_GAME_HOOK(PLAYER, CAN_PLAYER_USE_GUILD_CHAT, 153)
-        DEFINE_GAME_HOOK(PLAYER, CAN_PLAYER_USE_CHANNEL_CHAT, 154)
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_LEARN_TALENTS, 155)
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_ENTER_COMBAT, 156)
-        DEFINE_GAME_HOOK(PLAYER, ON_PLAYER_LEAVE_COMBAT, 157)
-        DEFINE_GAME_HOOK(PLAYER, ON_QUEST_ABANDON, 158)
-        DEFINE_GAME_HOOK(PLAYER, ON_GET_QUEST_RATE, 159)
-        DEFINE_GAME_HOOK(PLAYER, ON_CAN_PLAYER_FLY_IN_ZONE, 160)
-        DEFINE_GAME_HOOK(PLAYER, ANTICHEAT_SET_CAN_FLY_BY_SERVER, 161)
-        DEFINE_GAME_HOOK(PLAYER, ANTICHEAT_SET_UNDER_ACK_MOUNT, 162)
-        DEFINE_GAME_HOOK(PLAYER, ANTICHEAT_SET_ROOT_ACK_UPD, 163)
-        DEFINE_GAME_HOOK(PLAYER, ANTICHEAT_SET_JUMPING_BY_OPCODE, 164)
-        DEFINE_GAME_HOOK(PLAYER, ANTICHEAT_UPDATE_MOVEMENT_INFO, 165)
-        DEFINE_GAME_HOOK(PLAYER, ANTICHEAT_HANDLE_DOUBLE_JUMP, 166)
-        DEFINE_GAME_HOOK(PLAYER, ANTICHEAT_CHECK_MOVEMENT_INFO, 167)
-        DEFINE_GAME_HOOK(PLAYER, CAN_SEND_ERROR_ALREADY_LOOTED, 168)
-        DEFINE_GAME_HOOK(PLAYER, ON_AFTER_CREATURE_LOOT, 169)
-        DEFINE_GAME_HOOK(PLAYER, ON_AFTER_CREATURE_LOOT_MONEY, 170)
-        DEFINE_GAME_HOOK(PLAYER, ON_CAN_UPDATE_SKILL, 171)
-        DEFINE_GAME_HOOK(PLAYER, ON_BEFORE_UPDATE_SKILL, 172)
-        DEFINE_GAME_HOOK(PLAYER, ON_UPDATE_SKILL, 173)
-        DEFINE_GAME_HOOK(PLAYER, CAN_RESURRECT, 174)
-        DEFINE_GAME_HOOK(PLAYER, ON_CAN_GIVE_LEVEL, 175)
-        DEFINE_GAME_HOOK(PLAYER, ON_SEND_LIST_INVENTORY, 176)
-        DEFINE_GAME_HOOK(PLAYER, ON_GIVE_REPUTATION, 177)
+        PYENG_PLAYER_HOOKS(DEFINE_GAME_HOOK)
     }
 
 } // namespace PyEng::Hooks
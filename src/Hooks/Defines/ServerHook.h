@@ -2,17 +2,28 @@
 #define MOD_PYTHON_ENGINE_SERVER_HOOK_H
 
 #include "HookRegistry.h"
+#include "BufferView.h"
+
+class Player;
+
+/**
+ * @brief Server hook list: HOOK(Category, Name, Id, (Type, name)...)
+ */
+#define PYENG_SERVER_HOOKS(HOOK) \
+    HOOK(SERVER, ON_NETWORK_START, 0) \
+    HOOK(SERVER, ON_NETWORK_STOP, 1) \
+    HOOK(SERVER, ON_SOCKET_OPEN, 2) \
+    HOOK(SERVER, ON_SOCKET_CLOSE, 3) \
+    HOOK(SERVER, CAN_PACKET_SEND, 4, (::Player*, player), (uint32, accountId), (uint16, opcode), \
+         (::PyEng::Utilities::BufferView, payload)) \
+    HOOK(SERVER, CAN_PACKET_RECEIVE, 5, (::Player*, player), (uint32, accountId), (uint16, opcode), \
+         (::PyEng::Utilities::BufferView, payload))
 
 namespace PyEng::Hooks
 {
     namespace Server
     {
-        DEFINE_GAME_HOOK(SERVER, ON_NETWORK_START, 0)
-        DEFINE_GAME_HOOK(SERVER, ON_NETWORK_STOP, 1)
-        DEFINE_GAME_HOOK(SERVER, ON_SOCKET_OPEN, 2)
-        DEFINE_GAME_HOOK(SERVER, ON_SOCKET_CLOSE, 3)
-        DEFINE_GAME_HOOK(SERVER, CAN_PACKET_SEND, 4)
-        DEFINE_GAME_HOOK(SERVER, CAN_PACKET_RECEIVE, 5)
+        PYENG_SERVER_HOOKS(DEFINE_GAME_HOOK)
     }
 
 } // namespace PyEng::Hooks
@@ -0,0 +1,122 @@
+#ifndef MOD_PYTHON_ENGINE_HOOK_BATCH_H
+#define MOD_PYTHON_ENGINE_HOOK_BATCH_H
+
+#include "HookDefines.h"
+#include "ObjectGuid.h"
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace PyEng::Hooks
+{
+    /**
+     * @brief Hooks that can be delivered in batches (RegisterBatch)
+     *
+     * Every batched event is reduced to one record: source and target GUID,
+     * amount, spell id (0 if the hook has none) and timestamp.
+     */
+    inline constexpr std::array BATCH_HOOKS = {
+        Unit::ON_HEAL,
+        Unit::ON_DAMAGE,
+        Unit::MODIFY_PERIODIC_DAMAGE_AURAS_TICK,
+        Unit::MODIFY_MELEE_DAMAGE,
+        Unit::MODIFY_SPELL_DAMAGE_TAKEN,
+        Unit::MODIFY_HEAL_RECEIVED,
+    };
+
+    /**
+     * @brief Events of one batch subscription, stored as struct-of-arrays
+     *
+     * Triggering threads append under a short per-batch lock; the world
+     * thread swaps the columns with its own (reused) buffers once the
+     * interval elapsed, so the steady state does not allocate.
+     */
+    class HookBatch
+    {
+    public:
+        /**
+         * @brief Column buffers, one element per event
+         */
+        struct Columns
+        {
+            std::vector<uint64> sources; // ObjectGuid raw values
+            std::vector<uint64> targets; // ObjectGuid raw values
+            std::vector<int64> amounts;
+            std::vector<uint32> spells;
+            std::vector<uint32> times; // getMSTime() at trigger
+
+            [[nodiscard]] std::size_t Size() const noexcept { return amounts.size(); }
+
+            void Clear() noexcept
+            {
+                sources.clear();
+                targets.clear();
+                amounts.clear();
+                spells.clear();
+                times.clear();
+            }
+        };
+
+        /**
+         * @param interval Delivery interval in milliseconds
+         */
+        explicit HookBatch(uint32 interval) : interval(interval) {}
+
+        HookBatch(HookBatch const&) = delete;
+        HookBatch& operator=(HookBatch const&) = delete;
+
+        /**
+         * @brief Appends an event (any thread)
+         */
+        void Append(ObjectGuid source, ObjectGuid target, int64 amount, uint32 spellId, uint32 time)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            collecting.sources.push_back(source.GetRawValue());
+            collecting.targets.push_back(target.GetRawValue());
+            collecting.amounts.push_back(amount);
+            collecting.spells.push_back(spellId);
+            collecting.times.push_back(time);
+        }
+
+        /**
+         * @brief Advances the interval timer (world thread)
+         *
+         * @param diff Time since last update in milliseconds
+         * @return True if the batch is due for delivery
+         */
+        bool Advance(uint32 diff) noexcept
+        {
+            elapsed += diff;
+            return IsDue();
+        }
+
+        [[nodiscard]] bool IsDue() const noexcept { return elapsed >= interval; }
+
+        /**
+         * @brief Takes the collected events and restarts the interval (world thread)
+         *
+         * @return Columns valid until the next Take()
+         */
+        Columns const& Take()
+        {
+            // A long update delivers once, it doesn't catch up
+            elapsed = elapsed >= interval ? (elapsed - interval) % interval : 0;
+            delivered.Clear();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            std::swap(delivered, collecting);
+            return delivered;
+        }
+
+    private:
+        uint32 interval;
+        uint32 elapsed = 0;
+
+        std::mutex mutex;
+        Columns collecting; // guarded by mutex
+        Columns delivered;  // world thread only
+    };
+
+} // namespace PyEng::Hooks
+
+#endif // MOD_PYTHON_ENGINE_HOOK_BATCH_H
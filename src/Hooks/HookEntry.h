@@ -0,0 +1,56 @@
+#ifndef MOD_PYTHON_ENGINE_HOOK_ENTRY_H
+#define MOD_PYTHON_ENGINE_HOOK_ENTRY_H
+
+#include "HookDefines.h"
+#include "OpcodeFilter.h"
+#include <array>
+
+namespace PyEng::Hooks
+{
+    /**
+     * @brief What the entry ID of a registration refers to
+     */
+    enum class EntryKind : uint8
+    {
+        None,     // global only, always triggered with entry 0
+        Template, // creature, gameobject or item template entry
+        Opcode,   // packet opcode (see PACKET_HOOKS)
+        Spell,    // spell id (see SPELL_HOOKS)
+    };
+
+    /**
+     * @brief Hooks raised for a spell, keyed by spell id
+     *
+     * Callbacks are registered with the spell id as entry ID; entry 0
+     * (global) receives every spell.
+     */
+    inline constexpr std::array SPELL_HOOKS = {
+        Player::ON_SPELL_CAST,
+        Unit::ON_AURA_APPLY,
+        Unit::ON_AURA_REMOVE,
+    };
+
+    /**
+     * @brief Entry kind the hook is triggered with
+     */
+    constexpr EntryKind GetEntryKind(HookInfo hinfo) noexcept
+    {
+        switch (hinfo.category)
+        {
+            case Category::CREATURE:
+            case Category::GAMEOBJECT:
+            case Category::ITEM:
+                return EntryKind::Template;
+            default:
+                break;
+        }
+
+        if (Contains(PACKET_HOOKS, hinfo))
+            return EntryKind::Opcode;
+
+        return Contains(SPELL_HOOKS, hinfo) ? EntryKind::Spell : EntryKind::None;
+    }
+
+} // namespace PyEng::Hooks
+
+#endif // MOD_PYTHON_ENGINE_HOOK_ENTRY_H
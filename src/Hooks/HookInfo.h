@@ -2,6 +2,7 @@
 #define MOD_PYTHON_ENGINE_HOOK_INFO_H
 
 #include "Define.h"
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 
@@ -23,6 +24,41 @@ namespace PyEng::Hooks
         WORLD,
     };
 
+    /**
+     * @brief Total number of hook categories
+     *
+     * @warning Must be kept in sync with the last Category value
+     */
+    inline constexpr std::size_t CATEGORY_COUNT = static_cast<std::size_t>(Category::WORLD) + 1;
+
+    /**
+     * @brief Maximum number of hooks per category (HookInfo::value is 8-bit)
+     */
+    inline constexpr std::size_t MAX_HOOKS_PER_CATEGORY = 256;
+
+    /**
+     * @brief Total number of addressable hook slots (Category x value)
+     */
+    inline constexpr std::size_t MAX_HOOK_SLOTS = CATEGORY_COUNT * MAX_HOOKS_PER_CATEGORY;
+
+    /**
+     * @brief Callback registration flags
+     */
+    enum HookFlag : uint32
+    {
+        HOOK_FLAG_NONE     = 0x00,
+        HOOK_FLAG_ASYNC    = 0x01, // run at the next world update with a value snapshot of the arguments
+        HOOK_FLAG_BATCH    = 0x02, // events collected into columns, set by RegisterBatch only
+        HOOK_FLAG_LAZY     = 0x04, // single event argument, attributes converted on first access
+        HOOK_FLAG_INTERVAL = 0x08, // throttled per object, set by Register with interval_ms only
+        HOOK_FLAG_WAKE     = 0x10, // resumes a coroutine suspended in wait_for, set by the engine only
+    };
+
+    /**
+     * @brief All known HookFlag bits
+     */
+    inline constexpr uint32 HOOK_FLAG_MASK = HOOK_FLAG_ASYNC | HOOK_FLAG_LAZY;
+
     /**
      * @brief Type-safe hook identifier
      */
@@ -31,6 +67,16 @@ namespace PyEng::Hooks
         Category category;
         uint8 value;
 
+        /**
+         * @brief Dense slot index of the hook: [category (8-bit)] [value (8-bit)]
+         *
+         * @return Index in range [0, MAX_HOOK_SLOTS)
+         */
+        constexpr std::size_t Index() const noexcept
+        {
+            return static_cast<std::size_t>(category) * MAX_HOOKS_PER_CATEGORY + value;
+        }
+
         constexpr bool operator==(HookInfo const& other) const noexcept
         {
             return category == other.category && value == other.value;
@@ -41,6 +87,21 @@ namespace PyEng::Hooks
         }
     };
 
+    /**
+     * @brief Checks if the hook is listed (ex., in BATCH_HOOKS)
+     *
+     * @param hooks Constexpr array of hooks
+     */
+    template<typename List>
+    constexpr bool Contains(List const& hooks, HookInfo hinfo) noexcept
+    {
+        for (HookInfo hook : hooks)
+            if (hook == hinfo)
+                return true;
+
+        return false;
+    }
+
 } // namespace PyEng::Hooks
 
 namespace std
@@ -3,24 +3,174 @@
 
 #include "PythonEngine.h"
 #include "HookDefines.h"
+#include "HookEntry.h"
+#include "HookSubscribers.h"
+
+namespace PyEng::Hooks
+{
+    /**
+     * @brief Validates call site arguments and triggers the hook
+     *
+     * Arguments are cast to the types declared in DEFINE_GAME_HOOK, so the
+     * engine instantiates a single trampoline per hook signature.
+     *
+     * @tparam Signature HookName_Signature of the triggered hook
+     */
+    template<typename Signature, typename... CallArgs>
+    inline void TriggerTyped(HookInfo hinfo, uint32 entryId, CallArgs&&... args)
+    {
+        static_assert(Signature::IsTyped, "Hook is declared without arguments, add them to DEFINE_GAME_HOOK");
+        static_assert(Signature::template Accepts<CallArgs...>,
+                      "TRIGGER_* arguments do not match the signature declared in DEFINE_GAME_HOOK");
+
+        if constexpr (Signature::IsTyped && Signature::template Accepts<CallArgs...>)
+            Signature::Trigger(*sPythonEngine, hinfo, entryId, std::forward<CallArgs>(args)...);
+    }
+
+    /**
+     * @brief Validates call site arguments and triggers the hook as a predicate
+     *
+     * @tparam Signature HookName_Signature of the triggered hook
+     * @return Answer of the first deciding callback, otherwise result
+     */
+    template<typename Signature, typename... CallArgs>
+    inline bool TriggerPredicateTyped(HookInfo hinfo, uint32 entryId, bool result, CallArgs&&... args)
+    {
+        static_assert(Signature::IsTyped, "Hook is declared without arguments, add them to DEFINE_GAME_HOOK");
+        static_assert(Signature::template Accepts<CallArgs...>,
+                      "TRIGGER_* arguments do not match the signature declared in DEFINE_GAME_HOOK");
+
+        if constexpr (Signature::IsTyped && Signature::template Accepts<CallArgs...>)
+            return Signature::TriggerPredicate(*sPythonEngine, hinfo, entryId, result, std::forward<CallArgs>(args)...);
+        else
+            return result;
+    }
+
+    /**
+     * @brief GUID of a possibly null game object
+     */
+    template<typename T>
+    inline ObjectGuid GuidOf(T const* object)
+    {
+        return object ? object->GetGUID() : ObjectGuid::Empty;
+    }
+
+} // namespace PyEng::Hooks
 
 /**
  * @brief Convenience Macros for Triggering Hooks
+ *
+ * The subscriber bitset is tested first: unless the hook has subscribers,
+ * neither the arguments (including Entry) are evaluated nor the engine
+ * singleton is touched. Arguments are checked at compile time against the
+ * hook signature.
  */
 
+#define PYENG_TRIGGER_HOOK(Scope, Hook, Entry, ...) \
+    do \
+    { \
+        if (PyEng::Hooks::HookSubscribers::Test(Scope::Hook)) \
+            PyEng::Hooks::TriggerTyped<Scope::Hook##_Signature>(Scope::Hook, Entry, ##__VA_ARGS__); \
+    } while (0)
+
 #define TRIGGER_ACCOUNT_HOOK(Hook, ...) \
-    sPythonEngine->Trigger(PyEng::Hooks::Account::Hook, 0, ##__VA_ARGS__)
+    PYENG_TRIGGER_HOOK(PyEng::Hooks::Account, Hook, 0, ##__VA_ARGS__)
 
 #define TRIGGER_PLAYER_HOOK(Hook, ...) \
-    sPythonEngine->Trigger(PyEng::Hooks::Player::Hook, 0, ##__VA_ARGS__)
+    PYENG_TRIGGER_HOOK(PyEng::Hooks::Player, Hook, 0, ##__VA_ARGS__)
 
 #define TRIGGER_CREATURE_HOOK(Hook, Entry, ...) \
-    sPythonEngine->Trigger(PyEng::Hooks::Creature::Hook, Entry, ##__VA_ARGS__)
+    PYENG_TRIGGER_HOOK(PyEng::Hooks::Creature, Hook, Entry, ##__VA_ARGS__)
 
 #define TRIGGER_GAMEOBJECT_HOOK(Hook, Entry, ...) \
-    sPythonEngine->Trigger(PyEng::Hooks::GameObject::Hook, Entry, ##__VA_ARGS__)
+    PYENG_TRIGGER_HOOK(PyEng::Hooks::GameObject, Hook, Entry, ##__VA_ARGS__)
 
 #define TRIGGER_ITEM_HOOK(Hook, Entry, ...) \
-    sPythonEngine->Trigger(PyEng::Hooks::Item::Hook, Entry, ##__VA_ARGS__)
+    PYENG_TRIGGER_HOOK(PyEng::Hooks::Item, Hook, Entry, ##__VA_ARGS__)
+
+#define TRIGGER_UNIT_HOOK(Hook, ...) \
+    PYENG_TRIGGER_HOOK(PyEng::Hooks::Unit, Hook, 0, ##__VA_ARGS__)
+
+#define TRIGGER_WORLD_HOOK(Hook, ...) \
+    PYENG_TRIGGER_HOOK(PyEng::Hooks::World, Hook, 0, ##__VA_ARGS__)
+
+/**
+ * @brief Convenience Macros for Spell Hooks, keyed by spell id
+ *
+ * SpellId is only evaluated when the hook has subscribers; callbacks
+ * registered for other spells are skipped before the GIL is taken.
+ */
+#define PYENG_TRIGGER_SPELL_HOOK(Scope, Hook, SpellId, ...) \
+    do \
+    { \
+        static_assert(PyEng::Hooks::Contains(PyEng::Hooks::SPELL_HOOKS, Scope::Hook), \
+                      "Hook is not listed in SPELL_HOOKS"); \
+        PYENG_TRIGGER_HOOK(Scope, Hook, SpellId, ##__VA_ARGS__); \
+    } while (0)
+
+#define TRIGGER_PLAYER_SPELL_HOOK(Hook, SpellId, ...) \
+    PYENG_TRIGGER_SPELL_HOOK(PyEng::Hooks::Player, Hook, SpellId, ##__VA_ARGS__)
+
+#define TRIGGER_UNIT_SPELL_HOOK(Hook, SpellId, ...) \
+    PYENG_TRIGGER_SPELL_HOOK(PyEng::Hooks::Unit, Hook, SpellId, ##__VA_ARGS__)
+
+/**
+ * @brief Convenience Macros for Predicate Hooks (CAN_*, gossip)
+ *
+ * Expressions evaluating to the answer of the callbacks, or Default when no
+ * callback decides (or the hook has no subscribers). Default is the value
+ * the script override returns without Python: true for CAN_* hooks (allowed
+ * unless vetoed), false for gossip and quest hooks (not handled).
+ */
+#define PYENG_TRIGGER_PREDICATE(Scope, Hook, Entry, Default, ...) \
+    (PyEng::Hooks::HookSubscribers::Test(Scope::Hook) \
+         ? PyEng::Hooks::TriggerPredicateTyped<Scope::Hook##_Signature>(Scope::Hook, Entry, Default, ##__VA_ARGS__) \
+         : (Default))
+
+#define TRIGGER_PLAYER_PREDICATE(Hook, Default, ...) \
+    PYENG_TRIGGER_PREDICATE(PyEng::Hooks::Player, Hook, 0, Default, ##__VA_ARGS__)
+
+#define TRIGGER_CREATURE_PREDICATE(Hook, Entry, Default, ...) \
+    PYENG_TRIGGER_PREDICATE(PyEng::Hooks::Creature, Hook, Entry, Default, ##__VA_ARGS__)
+
+#define TRIGGER_GAMEOBJECT_PREDICATE(Hook, Entry, Default, ...) \
+    PYENG_TRIGGER_PREDICATE(PyEng::Hooks::GameObject, Hook, Entry, Default, ##__VA_ARGS__)
+
+#define TRIGGER_ITEM_PREDICATE(Hook, Entry, Default, ...) \
+    PYENG_TRIGGER_PREDICATE(PyEng::Hooks::Item, Hook, Entry, Default, ##__VA_ARGS__)
+
+/**
+ * @brief Packet hook predicate keyed by opcode (network threads)
+ *
+ * The opcode filter replaces the subscriber test: packets without global or
+ * opcode callbacks return true (allowed) before any other work.
+ */
+#define TRIGGER_PACKET_PREDICATE(Hook, Opcode, ...) \
+    ([&]() -> bool \
+    { \
+        constexpr PyEng::Hooks::HookInfo hinfo = PyEng::Hooks::Server::Hook; \
+        static_assert(PyEng::Hooks::Contains(PyEng::Hooks::PACKET_HOOKS, hinfo), \
+                      "Hook is not listed in PACKET_HOOKS"); \
+        if (!PyEng::Hooks::OpcodeFilter::Test(hinfo, Opcode)) \
+            return true; \
+        return PyEng::Hooks::TriggerPredicateTyped<PyEng::Hooks::Server::Hook##_Signature>(hinfo, Opcode, true, \
+                                                                                          ##__VA_ARGS__); \
+    }())
+
+/**
+ * @brief Appends the event to batch subscriptions of the hook (RegisterBatch)
+ *
+ * Same subscriber test as the TRIGGER_* macros; Source and Target are unit
+ * pointers (may be null), SpellId is 0 for events without a spell.
+ */
+#define BATCH_UNIT_HOOK(Hook, Source, Target, Amount, SpellId) \
+    do \
+    { \
+        static_assert(PyEng::Hooks::Contains(PyEng::Hooks::BATCH_HOOKS, PyEng::Hooks::Unit::Hook), \
+                      "Hook is not listed in BATCH_HOOKS"); \
+        if (PyEng::Hooks::HookSubscribers::Test(PyEng::Hooks::Unit::Hook)) \
+            sPythonEngine->AppendBatch(PyEng::Hooks::Unit::Hook, PyEng::Hooks::GuidOf(Source), \
+                                       PyEng::Hooks::GuidOf(Target), Amount, SpellId); \
+    } while (0)
 
 #endif // MOD_PYTHON_ENGINE_HOOK_MACROS_H
@@ -0,0 +1,166 @@
+#ifndef MOD_PYTHON_ENGINE_HOOK_NAME_TABLE_H
+#define MOD_PYTHON_ENGINE_HOOK_NAME_TABLE_H
+
+#include "HookDefines.h"
+#include "PerfectHash.h"
+#include <array>
+#include <optional>
+#include <string_view>
+
+/**
+ * @brief All hook lists, in category order
+ */
+#define PYENG_ALL_HOOKS(HOOK) \
+    PYENG_ACCOUNT_HOOKS(HOOK) \
+    PYENG_PLAYER_HOOKS(HOOK) \
+    PYENG_CREATURE_HOOKS(HOOK) \
+    PYENG_GAMEOBJECT_HOOKS(HOOK) \
+    PYENG_ITEM_HOOKS(HOOK) \
+    PYENG_ACHIEVEMENT_HOOKS(HOOK) \
+    PYENG_SERVER_HOOKS(HOOK) \
+    PYENG_UNIT_HOOKS(HOOK) \
+    PYENG_WORLD_HOOKS(HOOK)
+
+// Category token -> namespace of its hook constants
+#define PYENG_HOOK_SCOPE_ACCOUNT PyEng::Hooks::Account
+#define PYENG_HOOK_SCOPE_PLAYER PyEng::Hooks::Player
+#define PYENG_HOOK_SCOPE_CREATURE PyEng::Hooks::Creature
+#define PYENG_HOOK_SCOPE_GAMEOBJECT PyEng::Hooks::GameObject
+#define PYENG_HOOK_SCOPE_ITEM PyEng::Hooks::Item
+#define PYENG_HOOK_SCOPE_ACHIEVEMENT PyEng::Hooks::Achievement
+#define PYENG_HOOK_SCOPE_SERVER PyEng::Hooks::Server
+#define PYENG_HOOK_SCOPE_UNIT PyEng::Hooks::Unit
+#define PYENG_HOOK_SCOPE_WORLD PyEng::Hooks::World
+
+#define PYENG_HOOK_DESCRIPTION(CategoryName, HookName, ...) \
+    PyEng::Hooks::HookDescription{#CategoryName "_" #HookName, PYENG_HOOK_SCOPE_##CategoryName::HookName, \
+                                  PYENG_HOOK_SCOPE_##CategoryName::HookName##_Signature::IsTyped, \
+                                  PYENG_HOOK_SCOPE_##CategoryName::HookName##_Signature::IsDeferrable, \
+                                  PYENG_HOOK_SCOPE_##CategoryName::HookName##_Signature::IsFilterable, \
+                                  PYENG_HOOK_SCOPE_##CategoryName::HookName##_Parameters.data(), \
+                                  PYENG_HOOK_SCOPE_##CategoryName::HookName##_Parameters.size()},
+
+namespace PyEng::Hooks
+{
+    /**
+     * @brief Name, identifier and declared arguments of a hook
+     */
+    struct HookDescription
+    {
+        std::string_view name; // with category prefix (ex., "PLAYER_ON_LOGIN")
+        HookInfo info;
+        bool typed;      // false if declared without arguments
+        bool deferrable; // all arguments have a value snapshot (HOOK_FLAG_ASYNC allowed)
+        bool filterable; // first argument is the player (callback filters allowed)
+        HookParameter const* parameters;
+        std::size_t arity;
+    };
+
+    /**
+     * @brief Every defined hook, generated from the category hook lists
+     */
+    inline constexpr auto HOOK_DESCRIPTIONS = std::array{PYENG_ALL_HOOKS(PYENG_HOOK_DESCRIPTION)};
+
+    inline constexpr std::size_t HOOK_COUNT = HOOK_DESCRIPTIONS.size();
+
+    namespace Detail
+    {
+        constexpr std::array<std::string_view, HOOK_COUNT> MakeHookNames()
+        {
+            std::array<std::string_view, HOOK_COUNT> names{};
+            for (std::size_t i = 0; i < HOOK_COUNT; ++i)
+                names[i] = HOOK_DESCRIPTIONS[i].name;
+
+            return names;
+        }
+
+        // HookInfo::Index() -> description index + 1 (0 = undefined)
+        constexpr std::array<uint16, MAX_HOOK_SLOTS> MakeReverseIndex()
+        {
+            std::array<uint16, MAX_HOOK_SLOTS> index{};
+            for (std::size_t i = 0; i < HOOK_COUNT; ++i)
+                index[HOOK_DESCRIPTIONS[i].info.Index()] = static_cast<uint16>(i + 1);
+
+            return index;
+        }
+
+        constexpr bool HasUniqueIds()
+        {
+            std::array<bool, MAX_HOOK_SLOTS> used{};
+            for (std::size_t i = 0; i < HOOK_COUNT; ++i)
+            {
+                std::size_t index = HOOK_DESCRIPTIONS[i].info.Index();
+                if (used[index])
+                    return false;
+
+                used[index] = true;
+            }
+
+            return true;
+        }
+
+        inline constexpr auto HOOK_NAMES = MakeHookNames();
+        inline constexpr auto HOOK_NAME_HASH = Utilities::PerfectHash<HOOK_COUNT>::Build(HOOK_NAMES);
+        inline constexpr auto HOOK_REVERSE_INDEX = MakeReverseIndex();
+
+        static_assert(HOOK_NAME_HASH.Valid(), "Hook names must be unique");
+        static_assert(HasUniqueIds(), "Two hooks share the same category and id");
+
+    } // namespace Detail
+
+    /**
+     * @brief Finds the description of a hook by name
+     *
+     * @param name String identifier for the hook (ex., "PLAYER_ON_LOGIN")
+     * @return Pointer to description, or nullptr if unknown
+     */
+    constexpr HookDescription const* FindHookDescription(std::string_view name) noexcept
+    {
+        std::size_t index = Detail::HOOK_NAME_HASH.Find(Detail::HOOK_NAMES, name);
+        return index < HOOK_COUNT ? &HOOK_DESCRIPTIONS[index] : nullptr;
+    }
+
+    /**
+     * @brief Finds the description of a hook by identifier
+     *
+     * @param hinfo Hook identifier
+     * @return Pointer to description, or nullptr if the hook is not defined
+     */
+    constexpr HookDescription const* FindHookDescription(HookInfo hinfo) noexcept
+    {
+        uint16 index = Detail::HOOK_REVERSE_INDEX[hinfo.Index()];
+        return index ? &HOOK_DESCRIPTIONS[index - 1] : nullptr;
+    }
+
+    /**
+     * @brief Resolves a string hook name to its corresponding HookInfo
+     *
+     * Perfect hash lookup: one hash, one table read, one string comparison.
+     *
+     * @param name String identifier for the hook (ex., "PLAYER_ON_LOGIN")
+     * @return HookInfo if found, otherwise std::nullopt
+     */
+    constexpr std::optional<HookInfo> GetHookByName(std::string_view name) noexcept
+    {
+        HookDescription const* description = FindHookDescription(name);
+        return description ? std::optional{description->info} : std::nullopt;
+    }
+
+    /**
+     * @brief Resolves a HookInfo to its name (for diagnostics)
+     *
+     * @param hinfo Hook identifier
+     * @return Hook name, or empty if the hook is not defined
+     */
+    constexpr std::string_view GetHookName(HookInfo hinfo) noexcept
+    {
+        uint16 index = Detail::HOOK_REVERSE_INDEX[hinfo.Index()];
+        return index ? HOOK_DESCRIPTIONS[index - 1].name : std::string_view();
+    }
+
+    static_assert(GetHookName(Player::ON_LOGIN) == "PLAYER_ON_LOGIN");
+    static_assert(GetHookByName("CREATURE_ON_GOSSIP_HELLO") == Creature::ON_GOSSIP_HELLO);
+
+} // namespace PyEng::Hooks
+
+#endif // MOD_PYTHON_ENGINE_HOOK_NAME_TABLE_H
@@ -2,69 +2,31 @@
 #define MOD_PYTHON_ENGINE_HOOK_REGISTRY_H
 
 #include "HookInfo.h"
-#include <optional>
-#include <string>
-#include <string_view>
-#include <unordered_map>
-
-namespace PyEng::Hooks
-{
-    /**
-     * @brief String-to-HookInfo lookup table (auto-populated at static init)
-     *
-     * This map is filled during static initialization by DEFINE_GAME_HOOK macros.
-     * Each DEFINE_GAME_HOOK creates a constant and registers its string name here.
-     *
-     * Example after initialization:
-     *   "PLAYER_ON_LOGIN"          -> HookInfo{Category::PLAYER, 32}
-     *   "PLAYER_ON_LOGOUT"         -> HookInfo{Category::PLAYER, 34}
-     *   "CREATURE_ON_GOSSIP_HELLO" -> HookInfo{Category::CREATURE, 0}
-     */
-    inline std::unordered_map<std::string, HookInfo>& GetHookMap()
-    {
-        static std::unordered_map<std::string, HookInfo> hookMap;
-        return hookMap;
-    }
-
-    /**
-     * @brief Internal registration helper called by DEFINE_GAME_HOOK macro
-     *
-     * @param name String identifier for the hook (ex., "PLAYER_ON_LOGIN")
-     * @param info Hook identifier structure
-     * @return Always returns true (used for static initialization)
-     */
-    inline bool RegisterHookInternal(char const* name, HookInfo info)
-    {
-        GetHookMap()[name] = info;
-        return true;
-    }
-
-    /**
-     * @brief Resolves a string hook name to its corresponding HookInfo
-     *
-     * @param name String identifier for the hook (ex., "PLAYER_ON_LOGIN")
-     * @return HookInfo if found, otherwise std::nullopt
-     */
-    inline std::optional<HookInfo> GetHookByName(std::string_view name)
-    {
-        auto const& hookMap = GetHookMap();
-        auto itr = hookMap.find(std::string(name));
-        return itr != hookMap.end() ? std::optional{itr->second} : std::nullopt;
-    }
-
-} // namespace PyEng::Hooks
+#include "HookSignature.h"
 
 /**
- * @brief Macro to define a hook constant and auto-register its string mapping
+ * @brief Macro to define a hook constant and its signature
  *
  * This macro does two things:
  * 1. Creates a constexpr HookInfo constant with the given name
- * 2. Registers the hook name WITH CATEGORY PREFIX in the string lookup map
+ * 2. Declares the HookName_Signature type and HookName_Parameters array from
+ *    the optional (Type, name) argument list
+ *
+ * Hook names are not registered at static init: each category header lists
+ * its hooks in a PYENG_<CATEGORY>_HOOKS(HOOK) X-macro, from which
+ * HookNameTable.h builds the compile-time name table.
+ *
+ * Hooks declared without arguments are untyped: they can be registered from
+ * Python, but TRIGGER_* macros reject them at compile time.
+ *
+ * @note Game classes clash with the category namespaces (Player, Item...),
+ *       spell them with the global scope prefix (::Player*).
  *
- * Usage: DEFINE_GAME_HOOK(PLAYER, ON_LOGIN, 32)
+ * Usage: DEFINE_GAME_HOOK(PLAYER, ON_LOGIN, 32, (::Player*, player))
  */
-#define DEFINE_GAME_HOOK(CategoryName, HookName, Id) \
-    inline constexpr HookInfo HookName = {Category::CategoryName, Id}; \
-    inline bool HookName##_registered = PyEng::Hooks::RegisterHookInternal(#CategoryName "_" #HookName, HookName);
+#define DEFINE_GAME_HOOK(CategoryName, HookName, ...) \
+    inline constexpr HookInfo HookName = {Category::CategoryName, PYENG_PP_HEAD(__VA_ARGS__)}; \
+    using HookName##_Signature = PYENG_HOOK_SIGNATURE(__VA_ARGS__); \
+    inline constexpr auto HookName##_Parameters = PYENG_HOOK_PARAMETERS(__VA_ARGS__);
 
 #endif // MOD_PYTHON_ENGINE_HOOK_REGISTRY_H
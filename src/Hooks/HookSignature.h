@@ -0,0 +1,185 @@
+#ifndef MOD_PYTHON_ENGINE_HOOK_SIGNATURE_H
+#define MOD_PYTHON_ENGINE_HOOK_SIGNATURE_H
+
+#include "HookInfo.h"
+#include "CallbackFilter.h"
+#include "DeferredCall.h"
+#include <array>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace PyEng::Hooks
+{
+    /**
+     * @brief Declared hook parameter (used for stub generation)
+     */
+    struct HookParameter
+    {
+        std::string_view type; // C++ type as written in DEFINE_GAME_HOOK
+        std::string_view name;
+    };
+
+    namespace Detail
+    {
+        template<typename Params, typename CallArgs, typename = void>
+        struct ArgumentsMatch : std::false_type
+        {
+        };
+
+        template<typename... Params, typename... CallArgs>
+        struct ArgumentsMatch<std::tuple<Params...>, std::tuple<CallArgs...>,
+                              std::enable_if_t<sizeof...(Params) == sizeof...(CallArgs)>>
+            : std::bool_constant<(std::is_convertible_v<CallArgs&&, Params> && ...)>
+        {
+        };
+
+    } // namespace Detail
+
+    /**
+     * @brief Compile-time argument list of a hook
+     *
+     * Trigger() is instantiated once per signature with the declared types,
+     * so every hook gets a dedicated conversion trampoline regardless of the
+     * exact expressions passed at the call sites.
+     *
+     * @tparam Args Declared C++ argument types
+     */
+    template<typename... Args>
+    struct Signature
+    {
+        static constexpr bool IsTyped = true;
+        static constexpr std::size_t Arity = sizeof...(Args);
+
+        /**
+         * @brief True if every argument has a value snapshot (async callbacks allowed)
+         */
+        static constexpr bool IsDeferrable = (DeferredValue<Args>::Supported && ...);
+
+        /**
+         * @brief True if the first argument is the player (callback filters allowed)
+         */
+        static constexpr bool IsFilterable = HasFilterSubject<Args...>;
+
+        using Arguments = std::tuple<Args...>;
+
+        /**
+         * @brief Checks that call site arguments convert to the declared types
+         */
+        template<typename... CallArgs>
+        static constexpr bool Accepts = Detail::ArgumentsMatch<Arguments, std::tuple<CallArgs...>>::value;
+
+        /**
+         * @brief Triggers the hook on the engine with the declared types
+         */
+        template<typename Engine, typename... CallArgs>
+        static void Trigger(Engine& engine, HookInfo hinfo, uint32 entryId, CallArgs&&... args)
+        {
+            engine.template Trigger<Args...>(hinfo, entryId, static_cast<Args>(std::forward<CallArgs>(args))...);
+        }
+
+        /**
+         * @brief Triggers the hook as a predicate (see PythonEngine::TriggerPredicate)
+         */
+        template<typename Engine, typename... CallArgs>
+        static bool TriggerPredicate(Engine& engine, HookInfo hinfo, uint32 entryId, bool result, CallArgs&&... args)
+        {
+            return engine.template TriggerPredicate<Args...>(hinfo, entryId, result,
+                                                             static_cast<Args>(std::forward<CallArgs>(args))...);
+        }
+    };
+
+    /**
+     * @brief Signature of hooks declared without an argument list
+     *
+     * Such hooks can be registered from Python but not triggered from C++
+     * until their arguments are declared.
+     */
+    struct UntypedSignature
+    {
+        static constexpr bool IsTyped = false;
+        static constexpr bool IsDeferrable = false;
+        static constexpr bool IsFilterable = false;
+        static constexpr std::size_t Arity = 0;
+
+        template<typename... CallArgs>
+        static constexpr bool Accepts = false;
+    };
+
+    namespace Detail
+    {
+        // First type is a placeholder, so an empty parameter list stays valid
+        template<typename Placeholder, typename... Args>
+        struct SignatureOf
+        {
+            using Type = Signature<Args...>;
+        };
+
+        template<typename Placeholder>
+        struct SignatureOf<Placeholder>
+        {
+            using Type = UntypedSignature;
+        };
+
+    } // namespace Detail
+
+} // namespace PyEng::Hooks
+
+/**
+ * @brief Preprocessor helpers for "Id, (Type, name)..." lists (up to 8 parameters)
+ *
+ * The leading hook id keeps the list non-empty, so untyped hooks need no
+ * empty __VA_ARGS__ detection.
+ */
+#define PYENG_PP_EXPAND(x) x
+#define PYENG_PP_CAT(a, b) PYENG_PP_CAT_(a, b)
+#define PYENG_PP_CAT_(a, b) a##b
+
+#define PYENG_PP_NARG(...) PYENG_PP_EXPAND(PYENG_PP_NARG_(__VA_ARGS__, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define PYENG_PP_NARG_(a1, a2, a3, a4, a5, a6, a7, a8, a9, N, ...) N
+
+#define PYENG_PP_HEAD(...) PYENG_PP_EXPAND(PYENG_PP_HEAD_(__VA_ARGS__, _))
+#define PYENG_PP_HEAD_(a, ...) a
+
+// Applies Macro to every element but the first (no separator)
+#define PYENG_PP_FOR_EACH_TAIL(Macro, ...) \
+    PYENG_PP_EXPAND(PYENG_PP_CAT(PYENG_PP_FOR_EACH_TAIL_, PYENG_PP_NARG(__VA_ARGS__))(Macro, __VA_ARGS__))
+#define PYENG_PP_FOR_EACH_TAIL_1(Macro, head)
+#define PYENG_PP_FOR_EACH_TAIL_2(Macro, head, a) Macro a
+#define PYENG_PP_FOR_EACH_TAIL_3(Macro, head, a, ...) \
+    Macro a PYENG_PP_EXPAND(PYENG_PP_FOR_EACH_TAIL_2(Macro, head, __VA_ARGS__))
+#define PYENG_PP_FOR_EACH_TAIL_4(Macro, head, a, ...) \
+    Macro a PYENG_PP_EXPAND(PYENG_PP_FOR_EACH_TAIL_3(Macro, head, __VA_ARGS__))
+#define PYENG_PP_FOR_EACH_TAIL_5(Macro, head, a, ...) \
+    Macro a PYENG_PP_EXPAND(PYENG_PP_FOR_EACH_TAIL_4(Macro, head, __VA_ARGS__))
+#define PYENG_PP_FOR_EACH_TAIL_6(Macro, head, a, ...) \
+    Macro a PYENG_PP_EXPAND(PYENG_PP_FOR_EACH_TAIL_5(Macro, head, __VA_ARGS__))
+#define PYENG_PP_FOR_EACH_TAIL_7(Macro, head, a, ...) \
+    Macro a PYENG_PP_EXPAND(PYENG_PP_FOR_EACH_TAIL_6(Macro, head, __VA_ARGS__))
+#define PYENG_PP_FOR_EACH_TAIL_8(Macro, head, a, ...) \
+    Macro a PYENG_PP_EXPAND(PYENG_PP_FOR_EACH_TAIL_7(Macro, head, __VA_ARGS__))
+#define PYENG_PP_FOR_EACH_TAIL_9(Macro, head, a, ...) \
+    Macro a PYENG_PP_EXPAND(PYENG_PP_FOR_EACH_TAIL_8(Macro, head, __VA_ARGS__))
+
+#define PYENG_HOOK_PARAMETER_TYPE(Type, Name) , Type
+#define PYENG_HOOK_PARAMETER_INFO(Type, Name) PyEng::Hooks::HookParameter{#Type, #Name},
+
+/**
+ * @brief Signature type of an "Id, (Type, name)..." list
+ */
+#define PYENG_HOOK_SIGNATURE(...) \
+    PyEng::Hooks::Detail::SignatureOf<void PYENG_PP_FOR_EACH_TAIL(PYENG_HOOK_PARAMETER_TYPE, __VA_ARGS__)>::Type
+
+/**
+ * @brief Parameter description array of an "Id, (Type, name)..." list
+ */
+#define PYENG_HOOK_PARAMETERS(...) \
+    std::array<PyEng::Hooks::HookParameter, PYENG_PP_NARG(__VA_ARGS__) - 1> \
+    { \
+        { \
+            PYENG_PP_FOR_EACH_TAIL(PYENG_HOOK_PARAMETER_INFO, __VA_ARGS__) \
+        } \
+    }
+
+#endif // MOD_PYTHON_ENGINE_HOOK_SIGNATURE_H
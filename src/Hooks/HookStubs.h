@@ -0,0 +1,141 @@
+#ifndef MOD_PYTHON_ENGINE_HOOK_STUBS_H
+#define MOD_PYTHON_ENGINE_HOOK_STUBS_H
+
+#include "HookBatch.h"
+#include "HookThrottle.h"
+#include "HookNameTable.h"
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace PyEng::Hooks
+{
+    /**
+     * @brief Maps a declared C++ parameter type to its Python annotation
+     *
+     * Qualifiers, pointers and references are dropped; arithmetic and string
+     * types map to builtins, game classes keep their exported name. Non-const
+     * arithmetic references are passed as MutableValue, buffers as memoryview.
+     *
+     * @param type C++ type as written in DEFINE_GAME_HOOK (ex., "::Quest const*")
+     * @return Python type name (ex., "Quest")
+     */
+    inline std::string ToPythonTypeName(std::string_view type)
+    {
+        std::string base;
+        for (std::size_t pos = 0; pos < type.size();)
+        {
+            std::size_t end = type.find_first_of(" *&", pos);
+            if (end == std::string_view::npos)
+                end = type.size();
+
+            std::string_view token = type.substr(pos, end - pos);
+            if (token.substr(0, 2) == "::")
+                token.remove_prefix(2);
+            if (!token.empty() && token != "const")
+                base.append(token);
+
+            pos = end + 1;
+        }
+
+        static constexpr std::array<std::string_view, 10> integers = {
+            "int8", "uint8", "int16", "uint16", "int32", "uint32", "int64", "uint64", "int", "unsigned",
+        };
+
+        bool isMutable = type.find('&') != std::string_view::npos && type.find("const") == std::string_view::npos;
+
+        for (std::string_view integer : integers)
+            if (base == integer)
+                return isMutable ? "MutableValue" : "int";
+
+        if (base == "bool")
+            return isMutable ? "MutableValue" : "bool";
+        if (base == "float" || base == "double")
+            return isMutable ? "MutableValue" : "float";
+        if (base == "char" || base == "std::string")
+            return "str";
+        if (base == "PyEng::Utilities::BufferView")
+            return "memoryview";
+
+        return base;
+    }
+
+    /**
+     * @brief Generates .pyi overloads of azerothcore.Register for typed hooks
+     *
+     * Each typed hook gets an overload with a Literal event name and the
+     * exact callback signature, so type checkers validate script handlers.
+     * A final overload takes any event for lazy handlers (one HookEvent
+     * argument). RegisterBatch is declared with the batch hook names,
+     * followed by the timer functions and the coroutine awaitables.
+     *
+     * @return Stub source text
+     */
+    inline std::string GenerateHookStubs()
+    {
+        // Hooks whose first argument is the player can be scoped
+        static constexpr std::string_view FILTER_PARAMETERS =
+            ", map: int | None = None, zone: int | None = None, area: int | None = None, "
+            "filter: dict[str, Any] | None = None";
+
+        std::string stubs = "from typing import Any, Callable, Literal, overload\n";
+
+        for (HookDescription const& description : HOOK_DESCRIPTIONS)
+        {
+            if (!description.typed)
+                continue;
+
+            std::string parameters;
+            for (std::size_t i = 0; i < description.arity; ++i)
+            {
+                if (i)
+                    parameters.append(", ");
+                parameters.append(ToPythonTypeName(description.parameters[i].type));
+            }
+
+            stubs.append("\n@overload\n");
+            stubs.append("def Register(event: Literal[\"").append(description.name).append("\"], callback: Callable[[");
+            stubs.append(parameters).append("], Any], entry: int = 0, flags: int = 0");
+            if (description.filterable)
+                stubs.append(FILTER_PARAMETERS);
+            if (Contains(INTERVAL_HOOKS, description.info))
+                stubs.append(", interval_ms: int = 0");
+            stubs.append(") -> None: ...\n");
+        }
+
+        // By-reference numbers, then lazy callbacks: (event)
+        stubs.append("\nclass MutableValue:\n    value: Any\n");
+        stubs.append("\nclass HookEvent:\n    def __getattr__(self, name: str) -> Any: ...\n");
+        stubs.append("\n@overload\n");
+        stubs.append("def Register(event: str, callback: Callable[[HookEvent], Any], entry: int = 0, ");
+        stubs.append("flags: int = 0").append(FILTER_PARAMETERS).append(", interval_ms: int = 0) -> None: ...\n");
+
+        // Batch callbacks: (sources, targets, amounts, spells, times)
+        std::string events;
+        for (HookInfo hinfo : BATCH_HOOKS)
+        {
+            if (!events.empty())
+                events.append(", ");
+            events.append("\"").append(GetHookName(hinfo)).append("\"");
+        }
+
+        stubs.append("\ndef RegisterBatch(event: Literal[").append(events).append("], callback: Callable[[");
+        stubs.append("memoryview, memoryview, memoryview, memoryview, memoryview], Any], ");
+        stubs.append("interval_ms: int) -> None: ...\n");
+
+        // Timers: callbacks take no arguments, handles are ints
+        stubs.append("\ndef Schedule(delay_ms: int, callback: Callable[[], Any]) -> int: ...\n");
+        stubs.append("def ScheduleRepeating(interval_ms: int, callback: Callable[[], Any]) -> int: ...\n");
+        stubs.append("def Cancel(handle: int) -> bool: ...\n");
+
+        // Awaited by async def callbacks
+        stubs.append("\nclass Awaitable:\n    def __await__(self) -> Any: ...\n");
+        stubs.append("\ndef sleep(ms: int) -> Awaitable: ...\n");
+        stubs.append("def wait_for(event: str, entry: int = 0, timeout_ms: int = 0) -> Awaitable: ...\n");
+
+        return stubs;
+    }
+
+} // namespace PyEng::Hooks
+
+#endif // MOD_PYTHON_ENGINE_HOOK_STUBS_H
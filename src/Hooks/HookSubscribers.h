@@ -0,0 +1,76 @@
+#ifndef MOD_PYTHON_ENGINE_HOOK_SUBSCRIBERS_H
+#define MOD_PYTHON_ENGINE_HOOK_SUBSCRIBERS_H
+
+#include "HookInfo.h"
+#include <array>
+#include <atomic>
+#include <bitset>
+
+namespace PyEng::Hooks
+{
+    /**
+     * @brief Global bitset of hooks with at least one subscriber
+     *
+     * One bit per HookInfo::Index(). Tested inline by the TRIGGER_* macros
+     * before any argument is evaluated or the engine is touched, so hooks
+     * nobody subscribed to cost a single relaxed load and a branch.
+     *
+     * The bitset is a hint: a set bit still goes through the registry
+     * snapshot, which remains the source of truth.
+     */
+    class HookSubscribers
+    {
+    public:
+        /**
+         * @brief Checks whether the hook has subscribers
+         *
+         * @param hinfo Hook identifier (compile-time constant in the macros)
+         * @return True if at least one callback is registered
+         */
+        [[nodiscard]] static bool Test(HookInfo hinfo) noexcept
+        {
+            std::size_t index = hinfo.Index();
+            return words[index / WORD_BITS].load(std::memory_order_relaxed) & (uint64(1) << (index % WORD_BITS));
+        }
+
+        /**
+         * @brief Replaces the whole bitset (called on registry publication)
+         *
+         * @param subscribed Bit per hook slot
+         */
+        static void Assign(std::bitset<MAX_HOOK_SLOTS> const& subscribed) noexcept
+        {
+            for (std::size_t word = 0; word < WORD_COUNT; ++word)
+            {
+                uint64 bits = 0;
+                for (std::size_t bit = 0; bit < WORD_BITS; ++bit)
+                    if (subscribed.test(word * WORD_BITS + bit))
+                        bits |= uint64(1) << bit;
+
+                words[word].store(bits, std::memory_order_relaxed);
+            }
+
+            generation.fetch_add(1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Number of Assign() calls, lets consumers detect changes
+         */
+        [[nodiscard]] static uint32 Generation() noexcept
+        {
+            return generation.load(std::memory_order_acquire);
+        }
+
+    private:
+        HookSubscribers() = delete;
+
+        static constexpr std::size_t WORD_BITS = 64;
+        static constexpr std::size_t WORD_COUNT = (MAX_HOOK_SLOTS + WORD_BITS - 1) / WORD_BITS;
+
+        inline static std::array<std::atomic<uint64>, WORD_COUNT> words{};
+        inline static std::atomic<uint32> generation{0};
+    };
+
+} // namespace PyEng::Hooks
+
+#endif // MOD_PYTHON_ENGINE_HOOK_SUBSCRIBERS_H
@@ -0,0 +1,269 @@
+#ifndef MOD_PYTHON_ENGINE_HOOK_TABLE_H
+#define MOD_PYTHON_ENGINE_HOOK_TABLE_H
+
+#include "HookInfo.h"
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace PyEng::Hooks
+{
+    /**
+     * @brief Dense hook dispatch table indexed by Category x hook value
+     *
+     * Every HookInfo maps to a fixed position of a flat index array, so the
+     * lookup is a single array read with no hashing. Only hooks that have at
+     * least one callback own a slot; slots are stored contiguously.
+     *
+     * Memory layout:
+     *   slotIndex[HookInfo::Index()] -> 0 (no callbacks) or slot position + 1
+     *   slots[position]              -> global callbacks + sorted entry index
+     *                                   + entry bitmap
+     *
+     * @tparam Callback Stored callback type
+     */
+    template<typename Callback>
+    class HookTable
+    {
+    public:
+        using CallbackList = std::vector<Callback>;
+
+        /**
+         * @brief Entry IDs below this bound are tracked by the per-slot bitmap
+         * (at most 128 KB per hook); larger IDs fall back to binary search
+         */
+        static constexpr uint32 MAX_MASKED_ENTRY = 1u << 20;
+
+        /**
+         * @brief Callbacks bound to a specific entry ID
+         */
+        struct EntryCallbacks
+        {
+            uint32 entryId;
+            CallbackList callbacks;
+
+            bool operator<(uint32 id) const noexcept { return entryId < id; }
+        };
+
+        /**
+         * @brief Callbacks registered for a single hook
+         */
+        struct Slot
+        {
+            CallbackList global;                 // entryId = 0
+            std::vector<EntryCallbacks> entries; // sorted by entryId
+            std::vector<uint64> entryMask;       // bit per entryId below MAX_MASKED_ENTRY
+            bool hasUnmaskedEntries = false;     // any entryId >= MAX_MASKED_ENTRY
+            bool hasFilters = false;             // set by MarkFilters before publication
+
+            /**
+             * @brief Checks the entry bitmap (no hashing, no search)
+             *
+             * @param entryId Specific entry ID (creature, item, etc.)
+             * @return False if no callbacks are bound to the entry
+             */
+            [[nodiscard]] bool MayHaveEntry(uint32 entryId) const noexcept
+            {
+                if (entryId >= MAX_MASKED_ENTRY)
+                    return hasUnmaskedEntries;
+
+                std::size_t word = entryId / 64;
+                return word < entryMask.size() && (entryMask[word] & (uint64(1) << (entryId % 64)));
+            }
+
+            /**
+             * @brief Finds callbacks bound to the entry ID
+             *
+             * Unscripted entries are rejected by the bitmap, only scripted
+             * ones reach the binary search.
+             *
+             * @param entryId Specific entry ID (creature, item, etc.)
+             * @return Pointer to callbacks, or nullptr if none registered
+             */
+            [[nodiscard]] CallbackList const* FindEntry(uint32 entryId) const noexcept
+            {
+                if (!MayHaveEntry(entryId))
+                    return nullptr;
+
+                auto itr = std::lower_bound(entries.begin(), entries.end(), entryId);
+                return itr != entries.end() && itr->entryId == entryId ? &itr->callbacks : nullptr;
+            }
+
+            void MarkEntry(uint32 entryId)
+            {
+                if (entryId >= MAX_MASKED_ENTRY)
+                {
+                    hasUnmaskedEntries = true;
+                    return;
+                }
+
+                std::size_t word = entryId / 64;
+                if (word >= entryMask.size())
+                    entryMask.resize(word + 1, 0);
+
+                entryMask[word] |= uint64(1) << (entryId % 64);
+            }
+        };
+
+        /**
+         * @brief Finds the slot of the hook
+         *
+         * @param hinfo Hook identifier
+         * @return Pointer to slot, or nullptr if no callbacks registered
+         */
+        [[nodiscard]] Slot const* Find(HookInfo hinfo) const noexcept
+        {
+            uint16 position = slotIndex[hinfo.Index()];
+            return position ? &slots[position - 1] : nullptr;
+        }
+
+        /**
+         * @brief Appends callback to the hook
+         *
+         * @param hinfo Hook identifier
+         * @param entryId Specific entry ID (creature, item, etc.; 0 = global)
+         * @param callback Callback to store
+         */
+        void Add(HookInfo hinfo, uint32 entryId, Callback callback)
+        {
+            Slot& slot = GetOrCreate(hinfo);
+            if (!entryId)
+            {
+                slot.global.push_back(std::move(callback));
+                return;
+            }
+
+            auto itr = std::lower_bound(slot.entries.begin(), slot.entries.end(), entryId);
+            if (itr == slot.entries.end() || itr->entryId != entryId)
+            {
+                itr = slot.entries.insert(itr, EntryCallbacks{entryId, {}});
+                slot.MarkEntry(entryId);
+            }
+
+            itr->callbacks.push_back(std::move(callback));
+        }
+
+        /**
+         * @brief Removes the matching callbacks, then the slots left empty
+         *
+         * @param predicate bool(Callback const&)
+         * @return Number of removed callbacks
+         */
+        template<typename Predicate>
+        std::size_t RemoveIf(Predicate predicate)
+        {
+            std::size_t removed = 0;
+            auto removeFrom = [&predicate, &removed](CallbackList& callbacks) {
+                auto itr = std::remove_if(callbacks.begin(), callbacks.end(), predicate);
+                removed += static_cast<std::size_t>(callbacks.end() - itr);
+                callbacks.erase(itr, callbacks.end());
+            };
+
+            std::vector<Slot> kept;
+            kept.reserve(slots.size());
+
+            for (uint16& position : slotIndex)
+            {
+                if (!position)
+                    continue;
+
+                Slot& slot = slots[position - 1];
+                removeFrom(slot.global);
+
+                // Entry bitmap is rebuilt from the entries still scripted
+                slot.entryMask.clear();
+                slot.hasUnmaskedEntries = false;
+                for (EntryCallbacks& entry : slot.entries)
+                    removeFrom(entry.callbacks);
+
+                slot.entries.erase(std::remove_if(slot.entries.begin(), slot.entries.end(),
+                                                  [](EntryCallbacks const& entry) { return entry.callbacks.empty(); }),
+                                   slot.entries.end());
+
+                for (EntryCallbacks const& entry : slot.entries)
+                    slot.MarkEntry(entry.entryId);
+
+                if (slot.global.empty() && slot.entries.empty())
+                {
+                    position = 0;
+                    continue;
+                }
+
+                kept.push_back(std::move(slot));
+                position = static_cast<uint16>(kept.size());
+            }
+
+            slots = std::move(kept);
+            return removed;
+        }
+
+        /**
+         * @brief Flags the slots holding at least one filtered callback
+         *
+         * Computed once when a snapshot is published, so dispatches of
+         * unfiltered hooks skip reading the filter subject.
+         *
+         * @param isFiltered bool(Callback const&)
+         */
+        template<typename Predicate>
+        void MarkFilters(Predicate isFiltered)
+        {
+            for (Slot& slot : slots)
+            {
+                slot.hasFilters = std::any_of(slot.global.begin(), slot.global.end(), isFiltered);
+                for (EntryCallbacks const& entry : slot.entries)
+                    slot.hasFilters = slot.hasFilters ||
+                                      std::any_of(entry.callbacks.begin(), entry.callbacks.end(), isFiltered);
+            }
+        }
+
+        /**
+         * @brief Removes all callbacks and slots
+         */
+        void Clear() noexcept
+        {
+            slotIndex.fill(0);
+            slots.clear();
+        }
+
+        [[nodiscard]] bool Empty() const noexcept { return slots.empty(); }
+
+        /**
+         * @brief Builds a bitset of hooks owning a slot (at least one callback)
+         *
+         * @return Bit per HookInfo::Index()
+         */
+        [[nodiscard]] std::bitset<MAX_HOOK_SLOTS> Subscribed() const noexcept
+        {
+            std::bitset<MAX_HOOK_SLOTS> subscribed;
+            for (std::size_t index = 0; index < MAX_HOOK_SLOTS; ++index)
+                subscribed.set(index, slotIndex[index] != 0);
+
+            return subscribed;
+        }
+
+    private:
+        Slot& GetOrCreate(HookInfo hinfo)
+        {
+            static_assert(MAX_HOOK_SLOTS <= std::numeric_limits<uint16>::max(), "Slot position must fit in uint16");
+
+            uint16& position = slotIndex[hinfo.Index()];
+            if (!position)
+            {
+                slots.emplace_back();
+                position = static_cast<uint16>(slots.size());
+            }
+
+            return slots[position - 1];
+        }
+
+        std::array<uint16, MAX_HOOK_SLOTS> slotIndex{};
+        std::vector<Slot> slots;
+    };
+
+} // namespace PyEng::Hooks
+
+#endif // MOD_PYTHON_ENGINE_HOOK_TABLE_H
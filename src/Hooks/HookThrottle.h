@@ -0,0 +1,172 @@
+#ifndef MOD_PYTHON_ENGINE_HOOK_THROTTLE_H
+#define MOD_PYTHON_ENGINE_HOOK_THROTTLE_H
+
+#include "HookDefines.h"
+#include <array>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace PyEng::Hooks
+{
+    /**
+     * @brief Per-tick hooks that can be throttled (Register with interval_ms)
+     *
+     * Their last argument is the update diff; the first one, if any, is the
+     * updated object.
+     */
+    inline constexpr std::array INTERVAL_HOOKS = {
+        Player::ON_UPDATE,
+        Unit::ON_UNIT_UPDATE,
+        World::ON_UPDATE,
+    };
+
+    /**
+     * @brief Checks if arguments have the shape of an interval hook: ([object*,] uint32 diff)
+     */
+    template<typename... Args>
+    inline constexpr bool IsIntervalSignature = false;
+
+    template<typename Diff>
+    inline constexpr bool IsIntervalSignature<Diff> = std::is_same_v<std::decay_t<Diff>, uint32>;
+
+    template<typename Object, typename Diff>
+    inline constexpr bool IsIntervalSignature<Object, Diff> =
+        std::is_pointer_v<std::decay_t<Object>> && std::is_same_v<std::decay_t<Diff>, uint32>;
+
+    /**
+     * @brief Update diffs accumulated per object for one interval callback
+     *
+     * Accumulators live in a flat open-addressing array keyed by the object
+     * GUID (0 for the world). Updating threads advance them under a short
+     * per-throttle lock; entries of objects no longer updated (logged out,
+     * idle grid) are dropped when the array is rebuilt.
+     */
+    class HookThrottle
+    {
+    public:
+        /**
+         * @param interval Minimum time between two calls, in milliseconds (non-zero)
+         */
+        explicit HookThrottle(uint32 interval) : interval(interval), slots(MIN_CAPACITY) {}
+
+        HookThrottle(HookThrottle const&) = delete;
+        HookThrottle& operator=(HookThrottle const&) = delete;
+
+        /**
+         * @brief Adds the diff to the accumulator of the object (any thread)
+         *
+         * @param key Object GUID raw value (0 for the world)
+         * @param diff Time since the last update of the object in milliseconds
+         * @param tick Current world tick, used to expire accumulators
+         * @return Accumulated diff once the interval elapsed (accumulator restarted), otherwise 0
+         */
+        uint32 Advance(uint64 key, uint32 diff, uint32 tick)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            Accumulator& accumulator = Find(key, tick);
+            accumulator.lastTick = tick;
+            accumulator.elapsed += diff;
+
+            if (accumulator.elapsed < interval)
+                return 0;
+
+            uint32 elapsed = accumulator.elapsed;
+            accumulator.elapsed = 0;
+            return elapsed;
+        }
+
+        /**
+         * @brief Accumulator key of the updated object (first argument)
+         */
+        template<typename First, typename... Rest>
+        static uint64 KeyOf(First const& first, Rest const&...)
+        {
+            if constexpr (sizeof...(Rest) > 0)
+                return first ? first->GetGUID().GetRawValue() : 0;
+            else
+                return 0;
+        }
+
+        /**
+         * @brief Update diff (last argument)
+         */
+        template<typename... Args>
+        static uint32 DiffOf(Args const&... args)
+        {
+            return std::get<sizeof...(Args) - 1>(std::tie(args...));
+        }
+
+    private:
+        static constexpr std::size_t MIN_CAPACITY = 64;
+        static constexpr uint32 STALE_TICKS = 600; // not updated for that many world ticks
+        static constexpr uint64 EMPTY_KEY = ~uint64(0);
+
+        struct Accumulator
+        {
+            uint64 key = EMPTY_KEY;
+            uint32 elapsed = 0;
+            uint32 lastTick = 0;
+        };
+
+        Accumulator& Find(uint64 key, uint32 tick)
+        {
+            std::size_t index = Probe(slots, key);
+            if (slots[index].key == key)
+                return slots[index];
+
+            // Keep the load factor under 1/2, rebuilding drops stale entries
+            if ((used + 1) * 2 > slots.size())
+            {
+                Rebuild(tick);
+                index = Probe(slots, key);
+            }
+
+            ++used;
+            slots[index].key = key;
+            return slots[index];
+        }
+
+        void Rebuild(uint32 tick)
+        {
+            std::vector<Accumulator> live;
+            live.reserve(used);
+            for (Accumulator const& accumulator : slots)
+                if (accumulator.key != EMPTY_KEY && tick - accumulator.lastTick <= STALE_TICKS)
+                    live.push_back(accumulator);
+
+            std::size_t capacity = MIN_CAPACITY;
+            while (capacity < (live.size() + 1) * 4)
+                capacity *= 2;
+
+            slots.assign(capacity, Accumulator{});
+            for (Accumulator const& accumulator : live)
+                slots[Probe(slots, accumulator.key)] = accumulator;
+
+            used = live.size();
+        }
+
+        // Slot holding the key, or the empty slot ending its probe sequence
+        static std::size_t Probe(std::vector<Accumulator> const& table, uint64 key) noexcept
+        {
+            std::size_t mask = table.size() - 1;
+            std::size_t index = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+
+            while (table[index].key != key && table[index].key != EMPTY_KEY)
+                index = (index + 1) & mask;
+
+            return index;
+        }
+
+        uint32 interval;
+
+        std::mutex mutex;
+        std::vector<Accumulator> slots; // guarded by mutex, power of two size
+        std::size_t used = 0;           // guarded by mutex
+    };
+
+} // namespace PyEng::Hooks
+
+#endif // MOD_PYTHON_ENGINE_HOOK_THROTTLE_H
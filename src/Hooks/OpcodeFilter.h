@@ -0,0 +1,103 @@
+#ifndef MOD_PYTHON_ENGINE_OPCODE_FILTER_H
+#define MOD_PYTHON_ENGINE_OPCODE_FILTER_H
+
+#include "HookDefines.h"
+#include <array>
+#include <atomic>
+
+namespace PyEng::Hooks
+{
+    /**
+     * @brief Hooks raised for every network packet, keyed by opcode
+     *
+     * Callbacks are registered with the opcode as entry ID; entry 0 (global)
+     * receives every packet.
+     */
+    inline constexpr std::array PACKET_HOOKS = {
+        Server::CAN_PACKET_SEND,
+        Server::CAN_PACKET_RECEIVE,
+    };
+
+    /**
+     * @brief Bit per opcode with callbacks, one filter per packet hook
+     *
+     * Tested by the network threads before the registry snapshot is pinned,
+     * so packets nobody subscribed to cost a relaxed load and a branch. Like
+     * HookSubscribers the filter is a hint, rebuilt on every publication.
+     */
+    class OpcodeFilter
+    {
+    public:
+        static constexpr std::size_t OPCODE_COUNT = 1 << 16;
+
+        /**
+         * @brief Checks whether the packet may have callbacks
+         *
+         * @param hinfo Packet hook (one of PACKET_HOOKS)
+         * @param opcode Packet opcode
+         * @return False if neither global nor opcode callbacks are registered
+         */
+        [[nodiscard]] static bool Test(HookInfo hinfo, uint16 opcode) noexcept
+        {
+            Filter const& filter = filters[IndexOf(hinfo)];
+            if (filter.global.load(std::memory_order_relaxed))
+                return true;
+
+            return filter.words[opcode / WORD_BITS].load(std::memory_order_relaxed) &
+                   (uint64(1) << (opcode % WORD_BITS));
+        }
+
+        /**
+         * @brief Rebuilds the filters from the entry bitmaps of the registry
+         *
+         * @tparam Table HookTable of the engine
+         */
+        template<typename Table>
+        static void Assign(Table const& table) noexcept
+        {
+            for (std::size_t i = 0; i < PACKET_HOOKS.size(); ++i)
+            {
+                auto const* slot = table.Find(PACKET_HOOKS[i]);
+                Filter& filter = filters[i];
+
+                for (std::size_t word = 0; word < WORD_COUNT; ++word)
+                {
+                    uint64 bits = slot && word < slot->entryMask.size() ? slot->entryMask[word] : 0;
+                    filter.words[word].store(bits, std::memory_order_relaxed);
+                }
+
+                filter.global.store(slot && !slot->global.empty(), std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Position of the hook in PACKET_HOOKS
+         */
+        static constexpr std::size_t IndexOf(HookInfo hinfo) noexcept
+        {
+            std::size_t index = 0;
+            while (index < PACKET_HOOKS.size() - 1 && PACKET_HOOKS[index] != hinfo)
+                ++index;
+
+            return index;
+        }
+
+    private:
+        OpcodeFilter() = delete;
+
+        static constexpr std::size_t WORD_BITS = 64;
+        static constexpr std::size_t WORD_COUNT = OPCODE_COUNT / WORD_BITS;
+
+        struct Filter
+        {
+            std::array<std::atomic<uint64>, WORD_COUNT> words;
+            std::atomic<bool> global; // any callback with entry 0
+        };
+
+        // Static storage: zero-initialized (nothing subscribed)
+        inline static std::array<Filter, PACKET_HOOKS.size()> filters;
+    };
+
+} // namespace PyEng::Hooks
+
+#endif // MOD_PYTHON_ENGINE_OPCODE_FILTER_H
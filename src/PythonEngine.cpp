@@ -1,12 +1,53 @@
 #include "PythonEngine.h"
 #include "PythonOutput.h"
-#include "HookRegistry.h"
+#include "PythonAwaitable.h"
+#include "HookEntry.h"
+#include "HookNameTable.h"
+#include "HookSubscribers.h"
+#include "OpcodeFilter.h"
 #include "Config.h"
 #include "Timer.h"
+#include <algorithm>
 #include <filesystem>
 
 namespace fs = std::filesystem;
 
+namespace
+{
+    /**
+     * @brief Qualified name of the coroutine function, for diagnostics (requires GIL)
+     */
+    std::string GetCoroutineName(API::Object const& coroutine)
+    {
+        try
+        {
+            return boost::python::extract<std::string>(coroutine.attr("__qualname__"));
+        }
+        catch (...)
+        {
+            PyErr_Clear();
+            return "<coroutine>";
+        }
+    }
+
+    /**
+     * @brief Closes the coroutine, running its finally blocks (requires GIL)
+     */
+    void CloseCoroutine(API::Object const& coroutine)
+    {
+        try
+        {
+            coroutine.attr("close")();
+        }
+        catch (...)
+        {
+            std::string error = ExceptionHelper::Format();
+            LOG_ERROR("module.python", "Error closing coroutine '{}'", GetCoroutineName(coroutine));
+            LOG_ERROR("module.python", "{}", error);
+        }
+    }
+} // anonymous namespace
+
 // Singleton Instance
 PythonEngine* PythonEngine::instance()
 {
@@ -37,6 +78,15 @@ void PythonEngine::Initialize()
 
     LOG_INFO("module.python", "Initializing Python Engine...");
 
+#ifdef Py_GIL_DISABLED
+    LOG_WARN("module.python", "Free-threaded Python support is experimental and untested, "
+                              "prefer a standard (GIL) build on production servers.");
+#endif
+
+    useVectorcall = sConfigMgr->GetOption<bool>("Python.Dispatch.Vectorcall", true);
+    deferredCalls = std::make_unique<DeferredQueue>(
+        std::max<uint32>(sConfigMgr->GetOption<uint32>("Python.Dispatch.AsyncQueueSize", 4096), 2));
+
     try
     {
         InitAzerothCoreModule();
@@ -78,12 +128,19 @@ void PythonEngine::Shutdown()
 
     {
         ClearHooks();
+
+        GILGuard gil;
+        ProxyCache::Clear();
+        InstancePool<HookEvent>::Clear();
+        InstancePool<MutableValue>::Clear();
         main_namespace = API::Object(); // Release main module ref
     }
 
     // WARNING: This should only be called if no other C++ static objects hold
     // Python references, as accessing them after finalization causes crashes.
-    // The GIL is automatically destroyed during finalization.
+    // Finalization needs the thread state released by Initialize (GIL held),
+    // the GIL is automatically destroyed during finalization.
+    PyGILState_Ensure();
     Py_Finalize();
 
     LOG_INFO("module.python", "Python Engine shutdown complete.");
@@ -114,6 +171,9 @@ void PythonEngine::LoadScripts()
     int count = 0;
     GILGuard gil;
 
+    // Publish all hooks registered by the scripts as a single snapshot
+    RegistrationBatch batch(*this);
+
     for (auto const& entry : fs::recursive_directory_iterator(scriptsPath))
     {
         if (entry.path().extension() != ".py")
@@ -121,6 +181,10 @@ void PythonEngine::LoadScripts()
 
         LOG_DEBUG("module.python", "Executing script: {}...", entry.path().string());
 
+        // Timers set by the script body are owned by the file
+        timerOwners.push_back(entry.path().string());
+        currentOwner = static_cast<uint32>(timerOwners.size());
+
         try
         {
             API::ExecFile(entry.path().string(), main_namespace, main_namespace);
@@ -130,24 +194,567 @@ void PythonEngine::LoadScripts()
         {
             LOG_ERROR("module.python", "Failed to execute script: {}", entry.path().string());
             LOG_ERROR("module.python", "{}", ExceptionHelper::Format());
+
+            CancelOwnedTimers(currentOwner);
         }
     }
 
+    currentOwner = 0;
+
+#ifdef Py_GIL_DISABLED
+    if (API::IsGILEnabled())
+        LOG_WARN("module.python", "The GIL was enabled again, hooks of different maps are serialized.");
+#endif
+
     LOG_INFO("module.python", ">> Loaded {} Python scripts in {} ms.", count, GetMSTimeDiffToNow(oldMSTime));
 }
 
-void PythonEngine::ClearHooks()
+void PythonEngine::Update(uint32 diff)
+{
+    // Expires per-tick caches (ex., ObjectHandle resolution); 0 is reserved
+    // for "never resolved"
+    if (worldTick.fetch_add(1, std::memory_order_relaxed) + 1 == 0)
+        worldTick.store(1, std::memory_order_relaxed);
+
+    RunDeferredCalls();
+    FireTimers(diff);
+    RunCoroutines();
+    FlushBatches(diff);
+
+    // Free-threaded builds only: proxies neutered while scripts ran in parallel
+    ProxyCache::CollectRetired();
+}
+
+void PythonEngine::RunDeferredCalls()
+{
+    if (uint64 dropped = droppedCalls.exchange(0, std::memory_order_relaxed))
+        LOG_WARN("module.python", "Async hook queue is full, {} calls were dropped (Python.Dispatch.AsyncQueueSize)",
+                 dropped);
+
+    // Acquire: see hook modifications; queued calls wait for the reload
+    if (!enabled.load(std::memory_order_acquire) || reloading.load(std::memory_order_acquire))
+        return;
+
+    if (!deferredCalls || deferredCalls->Empty())
+        return;
+
+    TriggerDepthGuard depthGuard;
+    GILGuard gil;
+
+    uint32 generation = deferredGeneration.load(std::memory_order_relaxed);
+
+    // Bounded by the capacity: calls queued by async callbacks run next update
+    for (std::size_t budget = deferredCalls->Capacity(); budget > 0; --budget)
+    {
+        bool popped = deferredCalls->TryPop([this, generation](DeferredCall& call) {
+            if (call.GetGeneration() == generation)
+                call.Dispatch(this);
+        });
+
+        if (!popped)
+            break;
+    }
+}
+
+void PythonEngine::FlushBatches(uint32 diff)
+{
+    // Acquire: see hook modifications
+    if (!enabled.load(std::memory_order_acquire) || reloading.load(std::memory_order_acquire))
+        return;
+
+    bool due = false;
+
+    {
+        std::lock_guard<InterpreterMutex> lock(registryMutex);
+        for (BatchSubscription const& subscription : batches)
+            due |= subscription.batch->Advance(diff);
+    }
+
+    if (!due)
+        return;
+
+    TriggerDepthGuard depthGuard;
+
+    // Lock order: GIL first, then registryMutex
+    GILGuard gil;
+
+    // Copied, callbacks may register hooks
+    std::vector<BatchSubscription> flushed;
+
+    {
+        std::lock_guard<InterpreterMutex> lock(registryMutex);
+        for (BatchSubscription const& subscription : batches)
+            if (subscription.batch->IsDue())
+                flushed.push_back(subscription);
+    }
+
+    for (BatchSubscription const& subscription : flushed)
+    {
+        PyEng::Hooks::HookBatch::Columns const& columns = subscription.batch->Take();
+        if (!columns.Size())
+            continue;
+
+        try
+        {
+            ArgumentList<5> pyArgs = {
+                API::ToMemoryView(columns.sources.data(), columns.Size(), "Q"),
+                API::ToMemoryView(columns.targets.data(), columns.Size(), "Q"),
+                API::ToMemoryView(columns.amounts.data(), columns.Size(), "q"),
+                API::ToMemoryView(columns.spells.data(), columns.Size(), "I"),
+                API::ToMemoryView(columns.times.data(), columns.Size(), "I"),
+            };
+
+            SpawnCoroutine(Invoke(subscription.callable, pyArgs), 0);
+        }
+        catch (...)
+        {
+            LOG_ERROR("module.python", "Error in '{}' batch callback", GetHookName(subscription.hinfo));
+            LOG_ERROR("module.python", "{}", ExceptionHelper::Format());
+        }
+    }
+}
+
+void PythonEngine::FireTimers(uint32 diff)
+{
+    // Acquire: see initialization; timers wait for the reload
+    if (!enabled.load(std::memory_order_acquire) || reloading.load(std::memory_order_acquire))
+        return;
+
+    {
+        std::lock_guard<InterpreterMutex> lock(timerMutex);
+        timers.Advance(diff, expiredTimers);
+    }
+
+    if (expiredTimers.empty())
+        return;
+
+    TriggerDepthGuard depthGuard;
+    GILGuard gil;
+
+    for (TimerWheel::Handle handle : expiredTimers)
+    {
+        std::optional<ScheduledCall> call;
+
+        {
+            std::lock_guard<InterpreterMutex> lock(timerMutex);
+            call = timers.Fire(handle);
+        }
+
+        // Cancelled by a callback that ran before it
+        if (!call)
+            continue;
+
+        if (call->coroutine)
+        {
+            ExpireCoroutineTimer(call->coroutine);
+            continue;
+        }
+
+        // Timers set by the callback stay with the same script
+        currentOwner = call->owner;
+
+        try
+        {
+            SpawnCoroutine(Invoke(call->callable, ArgumentList<0>{}), 0);
+        }
+        catch (...)
+        {
+            LOG_ERROR("module.python", "Error in timer callback of '{}'", GetTimerOwner(call->owner));
+            LOG_ERROR("module.python", "{}", ExceptionHelper::Format());
+        }
+    }
+
+    currentOwner = 0;
+    expiredTimers.clear();
+}
+
+void PythonEngine::CancelOwnedTimers(uint32 owner)
+{
+    std::vector<ScheduledCall> cancelled;
+
+    {
+        std::lock_guard<InterpreterMutex> lock(timerMutex);
+        timers.CancelIf([owner](ScheduledCall const& call) { return call.owner == owner; }, cancelled);
+    }
+
+    if (!cancelled.empty())
+        LOG_DEBUG("module.python", "Cancelled {} timers of '{}'", cancelled.size(), GetTimerOwner(owner));
+}
+
+std::string_view PythonEngine::GetTimerOwner(uint32 owner) const
+{
+    return owner && owner <= timerOwners.size() ? std::string_view(timerOwners[owner - 1]) : "<runtime>";
+}
+
+void PythonEngine::CancelCoroutines(ObjectGuid guid)
+{
+    if (!ownedCoroutines.load(std::memory_order_relaxed))
+        return;
+
+    std::lock_guard<InterpreterMutex> lock(coroutineMutex);
+
+    auto owned = coroutinesByOwner.find(guid.GetRawValue());
+    if (owned == coroutinesByOwner.end())
+        return;
+
+    // Python objects are not touched: closed by RunCoroutines under the GIL
+    for (uint64 id : owned->second)
+    {
+        auto itr = coroutines.find(id);
+        if (itr == coroutines.end() || itr->second.cancelled)
+            continue;
+
+        itr->second.cancelled = true;
+        readyCoroutines.emplace_back(id, false);
+    }
+
+    coroutinesByOwner.erase(owned);
+    ownedCoroutines.store(coroutinesByOwner.size(), std::memory_order_relaxed);
+}
+
+bool PythonEngine::SpawnCoroutine(API::Object const& result, uint64 owner)
+{
+    if (!API::IsCoroutine(result))
+        return false;
+
+    uint64 id = 0;
+
+    {
+        std::lock_guard<InterpreterMutex> lock(coroutineMutex);
+
+        id = ++lastCoroutineId;
+        coroutines.emplace(id, CoroutineTask{result, owner, 0, nullptr, false});
+
+        if (owner)
+        {
+            coroutinesByOwner[owner].push_back(id);
+            ownedCoroutines.store(coroutinesByOwner.size(), std::memory_order_relaxed);
+        }
+    }
+
+    // Runs in place until its first await, while the event arguments are valid
+    ResumeCoroutine(id, API::Object());
+    return true;
+}
+
+void PythonEngine::ResumeCoroutine(uint64 id, API::Object const& value)
+{
+    CoroutineTask* task = nullptr;
+
+    {
+        std::lock_guard<InterpreterMutex> lock(coroutineMutex);
+
+        auto itr = coroutines.find(id);
+        if (itr == coroutines.end() || itr->second.cancelled)
+            return;
+
+        // Stable until EraseCoroutine (unordered_map keeps element addresses)
+        task = &itr->second;
+    }
+
+    // Woken by the hook: the timeout is no longer needed
+    if (task->timer)
+        CancelTimer(std::exchange(task->timer, 0));
+
+    // The waiter fired (hook or timeout), it is dropped from the registry
+    if (task->wake)
+    {
+        task->wake.reset();
+        staleWakes.store(true, std::memory_order_relaxed);
+    }
+
+    bool suspended = false;
+
+    try
+    {
+        API::Object awaited;
+        if (API::Send(task->coroutine, value, awaited))
+            suspended = ParkCoroutine(id, *task, awaited);
+    }
+    catch (...)
+    {
+        std::string error = ExceptionHelper::Format();
+        LOG_ERROR("module.python", "Error in coroutine '{}'", GetCoroutineName(task->coroutine));
+        LOG_ERROR("module.python", "{}", error);
+    }
+
+    if (!suspended)
+        EraseCoroutine(id);
+}
+
+bool PythonEngine::ParkCoroutine(uint64 id, CoroutineTask& task, API::Object const& awaited)
+{
+    boost::python::extract<Awaitable const&> extracted(awaited);
+    if (!extracted.check())
+    {
+        LOG_ERROR("module.python", "Coroutine '{}' awaited an object other than azerothcore.sleep or wait_for",
+                  GetCoroutineName(task.coroutine));
+        return false;
+    }
+
+    Awaitable const& awaitable = extracted();
+
+    if (awaitable.GetKind() == Awaitable::Kind::Event)
+    {
+        task.wake = std::make_shared<CoroutineWake>(id);
+        AddCallback(awaitable.GetHook(), awaitable.GetEntry(),
+                    HookCallback{API::Object(), PyEng::Hooks::HOOK_FLAG_WAKE, nullptr, {}, nullptr, task.wake},
+                    nullptr);
+    }
+
+    // Sleep delay, or wait_for timeout if any
+    if (awaitable.GetKind() == Awaitable::Kind::Sleep || awaitable.GetDelay())
+    {
+        std::lock_guard<InterpreterMutex> lock(timerMutex);
+        task.timer = timers.Schedule(awaitable.GetDelay(), 0, ScheduledCall{API::Object(), 0, id});
+    }
+
+    return true;
+}
+
+void PythonEngine::EraseCoroutine(uint64 id)
+{
+    CoroutineTask task;
+
+    {
+        std::lock_guard<InterpreterMutex> lock(coroutineMutex);
+
+        auto itr = coroutines.find(id);
+        if (itr == coroutines.end())
+            return;
+
+        task = std::move(itr->second);
+        coroutines.erase(itr);
+
+        auto owned = task.owner ? coroutinesByOwner.find(task.owner) : coroutinesByOwner.end();
+        if (owned != coroutinesByOwner.end())
+        {
+            std::vector<uint64>& ids = owned->second;
+            ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+            if (ids.empty())
+                coroutinesByOwner.erase(owned);
+
+            ownedCoroutines.store(coroutinesByOwner.size(), std::memory_order_relaxed);
+        }
+    }
+
+    if (task.timer)
+        CancelTimer(task.timer);
+
+    if (task.wake)
+    {
+        task.wake->fired.store(true, std::memory_order_relaxed);
+        staleWakes.store(true, std::memory_order_relaxed);
+    }
+
+    // No-op if the coroutine returned, raises GeneratorExit at its await otherwise
+    CloseCoroutine(task.coroutine);
+}
+
+void PythonEngine::ExpireCoroutineTimer(uint64 id)
 {
-    // Acquire exclusive lock and GIL, then clear hooks
-    std::unique_lock<std::shared_mutex> lock(hookMutex);
+    bool timedOut = false;
 
-    LOG_DEBUG("module.python", "All event handlers finished. Clearing hooks...");
+    {
+        std::lock_guard<InterpreterMutex> lock(coroutineMutex);
+
+        auto itr = coroutines.find(id);
+        if (itr == coroutines.end() || itr->second.cancelled)
+            return;
+
+        CoroutineTask& task = itr->second;
+        task.timer = 0;
+
+        // wait_for: the hook may have fired first, then RunCoroutines resumes it
+        if (task.wake)
+        {
+            if (task.wake->fired.exchange(true, std::memory_order_acq_rel))
+                return;
+
+            timedOut = true;
+        }
+    }
+
+    // sleep() evaluates to None, a wait_for timeout to False
+    ResumeCoroutine(id, timedOut ? API::Object(false) : API::Object());
+}
+
+void PythonEngine::WakeCoroutines(CallbackList const* global, CallbackList const* entry)
+{
+    for (CallbackList const* callbacks : {global, entry})
+    {
+        if (!callbacks)
+            continue;
+
+        for (auto const& callback : *callbacks)
+        {
+            if (callback.GetDispatch() != Dispatch::Wake)
+                continue;
+
+            // First trigger only; the waiter stays in this snapshot until removed
+            if (callback.wake->fired.exchange(true, std::memory_order_acq_rel))
+                continue;
+
+            std::lock_guard<InterpreterMutex> lock(coroutineMutex);
+            readyCoroutines.emplace_back(callback.wake->task, true);
+        }
+    }
+}
+
+void PythonEngine::RunCoroutines()
+{
+    // Acquire: see initialization; coroutines wait for the reload
+    if (!enabled.load(std::memory_order_acquire) || reloading.load(std::memory_order_acquire))
+        return;
+
+    std::vector<std::pair<uint64, bool>> ready;
 
+    {
+        std::lock_guard<InterpreterMutex> lock(coroutineMutex);
+        ready.swap(readyCoroutines);
+    }
+
+    if (ready.empty() && !staleWakes.load(std::memory_order_relaxed))
+        return;
+
+    TriggerDepthGuard depthGuard;
     GILGuard gil;
-    hookMap.clear();
+
+    // Cancelled ones are skipped by ResumeCoroutine
+    for (auto const& [id, woken] : ready)
+    {
+        if (woken)
+            ResumeCoroutine(id, API::Object(true));
+        else
+            EraseCoroutine(id);
+    }
+
+    if (!staleWakes.exchange(false, std::memory_order_relaxed))
+        return;
+
+    // Fired waiters are dropped at once, a single snapshot per update
+    {
+        std::lock_guard<InterpreterMutex> lock(registryMutex);
+
+        pendingHookMap.RemoveIf([](HookCallback const& callback) {
+            return callback.wake && callback.wake->fired.load(std::memory_order_relaxed);
+        });
+
+        if (!registrationBatch)
+            PublishHooks();
+    }
+
+    ReclaimHooks();
 }
 
-void PythonEngine::RegisterHook(std::string const& eventName, API::Object callback, uint32 entryId)
+void PythonEngine::ClearCoroutines()
+{
+    std::unordered_map<uint64, CoroutineTask> closed;
+
+    {
+        std::lock_guard<InterpreterMutex> lock(coroutineMutex);
+
+        closed.swap(coroutines);
+        coroutinesByOwner.clear();
+        readyCoroutines.clear();
+        ownedCoroutines.store(0, std::memory_order_relaxed);
+    }
+
+    // Their waiters and timers are cleared with the hooks and timers
+    staleWakes.store(false, std::memory_order_relaxed);
+
+    for (auto const& [id, task] : closed)
+        CloseCoroutine(task.coroutine);
+}
+
+void PythonEngine::ClearHooks()
+{
+    // Lock order: GIL first, then registryMutex
+    GILGuard gil;
+
+    // Closed first: finally blocks may still register hooks or timers
+    ClearCoroutines();
+
+    {
+        std::lock_guard<InterpreterMutex> lock(registryMutex);
+
+        LOG_DEBUG("module.python", "Clearing hooks...");
+
+        pendingHookMap.Clear();
+        batches.clear();
+        PublishHooks();
+
+        // Async calls queued so far belong to the cleared scripts
+        deferredGeneration.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ReclaimHooks();
+
+    // Callables are released outside of timerMutex (see ReclaimHooks)
+    std::vector<ScheduledCall> cancelled;
+
+    {
+        std::lock_guard<InterpreterMutex> lock(timerMutex);
+        timers.CancelIf([](ScheduledCall const&) { return true; }, cancelled);
+    }
+
+    cancelled.clear();
+    timerOwners.clear();
+}
+
+void PythonEngine::BeginRegistration()
+{
+    std::lock_guard<InterpreterMutex> lock(registryMutex);
+    ++registrationBatch;
+}
+
+void PythonEngine::EndRegistration()
+{
+    {
+        std::lock_guard<InterpreterMutex> lock(registryMutex);
+        if (--registrationBatch > 0)
+            return;
+
+        PublishHooks();
+    }
+
+    ReclaimHooks();
+}
+
+void PythonEngine::PublishHooks()
+{
+    // Copying the registry increments Python refcounts (GIL must be held)
+    auto snapshot = std::make_unique<HookRegistry>(pendingHookMap);
+    snapshot->MarkFilters([](HookCallback const& callback) { return !callback.filter.IsEmpty(); });
+    hookMap.Publish(std::move(snapshot));
+
+    // Updated after publication: a set bit always has a snapshot behind it
+    PyEng::Hooks::HookSubscribers::Assign(pendingHookMap.Subscribed());
+    PyEng::Hooks::OpcodeFilter::Assign(pendingHookMap);
+}
+
+void PythonEngine::ReclaimHooks()
+{
+    std::vector<std::unique_ptr<HookRegistry>> expired;
+
+    {
+        std::lock_guard<InterpreterMutex> lock(registryMutex);
+        expired = hookMap.CollectRetired();
+    }
+
+    // Snapshots are destroyed outside of registryMutex: releasing the last
+    // callback reference may run Python finalizers, which can switch threads
+    expired.clear();
+}
+
+std::string_view PythonEngine::GetHookName(HookInfo hinfo)
+{
+    std::string_view name = PyEng::Hooks::GetHookName(hinfo);
+    return name.empty() ? "<unknown>" : name;
+}
+
+void PythonEngine::RegisterHook(std::string const& eventName, API::Object callback, uint32 entryId, uint32 flags,
+                                PyEng::Hooks::CallbackFilter const& filter, uint32 interval)
 {
     // Acquire: see initialization
     if (!enabled.load(std::memory_order_acquire) || eventName.empty())
@@ -162,40 +769,215 @@ void PythonEngine::RegisterHook(std::string const& eventName, API::Object callba
         return;
     }
 
-    using PyEng::Hooks::GetHookByName;
-    auto hookIdOpt = GetHookByName(eventName);
+    using PyEng::Hooks::FindHookDescription;
+    auto const* description = FindHookDescription(eventName);
 
-    if (!hookIdOpt.has_value())
+    if (!description)
     {
         LOG_ERROR("module.python", "Attempted to register unknown event hook '{}'.", eventName);
         return;
     }
 
-    HookInfo hookId = hookIdOpt.value();
+    if (flags & ~PyEng::Hooks::HOOK_FLAG_MASK)
+    {
+        LOG_ERROR("module.python", "Attempted to register hook '{}' with unknown flags {:#x}.", eventName, flags);
+        return;
+    }
 
-    // If triggerDepth > 0, we are currently inside a Trigger (holding shared lock).
-    // Attempting to acquire unique lock now would cause a deadlock.
-    if (triggerDepth > 0)
+    // Hooks with by-ref arguments or non-object pointers must run in place
+    if ((flags & PyEng::Hooks::HOOK_FLAG_ASYNC) && !description->deferrable)
     {
-        LOG_ERROR("module.python", "CRITICAL: Attempted to register hook '{}' inside an event handler! "
-                  "Dynamic registration causes deadlocks and is forbidden.", eventName);
+        LOG_ERROR("module.python", "Hook '{}' cannot be registered as async: its arguments have no value snapshot.",
+                  eventName);
         return;
     }
 
-    std::unique_lock<std::shared_mutex> lock(hookMutex);
+    // Entry callbacks of a global-only hook would never run
+    using PyEng::Hooks::EntryKind;
+    EntryKind entryKind = PyEng::Hooks::GetEntryKind(description->info);
+
+    if (entryId && entryKind == EntryKind::None)
+    {
+        LOG_ERROR("module.python", "Attempted to register global hook '{}' for entry {}.", eventName, entryId);
+        return;
+    }
+
+    // Packet hooks are keyed by opcode (uint16)
+    if (entryKind == EntryKind::Opcode && entryId >= PyEng::Hooks::OpcodeFilter::OPCODE_COUNT)
+    {
+        LOG_ERROR("module.python", "Attempted to register hook '{}' for invalid opcode {}.", eventName, entryId);
+        return;
+    }
+
+    // Filters are tested on the player argument when the event is raised
+    if (!filter.IsEmpty() && !description->filterable)
+    {
+        LOG_ERROR("module.python", "Hook '{}' cannot be filtered: it has no player argument.", eventName);
+        return;
+    }
+
+    if (!filter.IsEmpty() && (flags & PyEng::Hooks::HOOK_FLAG_ASYNC))
+    {
+        LOG_ERROR("module.python", "Hook '{}' cannot be filtered as async.", eventName);
+        return;
+    }
+
+    // Per-object accumulators need the updated object and diff arguments
+    if (interval && !PyEng::Hooks::Contains(PyEng::Hooks::INTERVAL_HOOKS, description->info))
+    {
+        LOG_ERROR("module.python", "Hook '{}' cannot be registered with an interval: it is not a per-tick hook.",
+                  eventName);
+        return;
+    }
+
+    if (interval && (flags & PyEng::Hooks::HOOK_FLAG_ASYNC))
+    {
+        LOG_ERROR("module.python", "Hook '{}' cannot be registered with an interval as async.", eventName);
+        return;
+    }
+
+    // Event attributes are the parameter names declared in DEFINE_GAME_HOOK
+    if ((flags & PyEng::Hooks::HOOK_FLAG_LAZY) && !description->typed)
+    {
+        LOG_ERROR("module.python", "Hook '{}' cannot be registered as lazy: its parameters are not declared.",
+                  eventName);
+        return;
+    }
+
+    try
+    {
+        HookCallback hookCallback{callback, flags, nullptr, filter, nullptr, nullptr};
+        if (interval)
+        {
+            hookCallback.flags |= PyEng::Hooks::HOOK_FLAG_INTERVAL;
+            hookCallback.throttle = std::make_shared<PyEng::Hooks::HookThrottle>(interval);
+        }
+
+        AddCallback(description->info, entryId, std::move(hookCallback), nullptr);
+
+        LOG_DEBUG("module.python", "Registered hook '{}' (entry {}, flags {:#x}, interval {} ms)", eventName, entryId,
+                  flags, interval);
+    }
+    catch (...)
+    {
+        LOG_ERROR("module.python", "Failed to register hook '{}' (entry {})", eventName, entryId);
+        LOG_ERROR("module.python", "{}", ExceptionHelper::Format());
+    }
+}
+
+void PythonEngine::RegisterBatch(std::string const& eventName, API::Object callback, uint32 interval)
+{
+    // Acquire: see initialization
+    if (!enabled.load(std::memory_order_acquire) || eventName.empty())
+        return;
+
+    if (!PyCallable_Check(callback.ptr()))
+    {
+        LOG_ERROR("module.python", "Attempted to register a non-callable object for batch hook '{}'.", eventName);
+        return;
+    }
+
+    auto const* description = PyEng::Hooks::FindHookDescription(eventName);
+    if (!description || !PyEng::Hooks::Contains(PyEng::Hooks::BATCH_HOOKS, description->info))
+    {
+        LOG_ERROR("module.python", "Attempted to register '{}' as batch hook, it has no batch delivery.", eventName);
+        return;
+    }
+
+    if (!interval)
+    {
+        LOG_ERROR("module.python", "Attempted to register batch hook '{}' with a zero interval.", eventName);
+        return;
+    }
 
     try
     {
-        hookMap[hookId][entryId].push_back(callback);
-        LOG_DEBUG("module.python", "Registered hook '{}' (entry {})", eventName, entryId);
+        auto batch = std::make_shared<PyEng::Hooks::HookBatch>(interval);
+        BatchSubscription subscription{description->info, callback, batch};
+        HookCallback hookCallback{callback, PyEng::Hooks::HOOK_FLAG_BATCH, batch, {}, nullptr, nullptr};
+
+        AddCallback(description->info, 0, std::move(hookCallback), &subscription);
+
+        LOG_DEBUG("module.python", "Registered batch hook '{}' (interval {} ms)", eventName, interval);
     }
     catch (...)
     {
-        LOG_ERROR("module.python", "Failed to register hook '{}' (entry {})\n{}", eventName, entryId);
+        LOG_ERROR("module.python", "Failed to register batch hook '{}'", eventName);
         LOG_ERROR("module.python", "{}", ExceptionHelper::Format());
     }
 }
 
+uint64 PythonEngine::ScheduleTimer(API::Object callback, uint32 delay, uint32 period)
+{
+    // Acquire: see initialization
+    if (!enabled.load(std::memory_order_acquire))
+        return 0;
+
+    if (!PyCallable_Check(callback.ptr()))
+    {
+        LOG_ERROR("module.python", "Attempted to schedule a non-callable object (delay {} ms).", delay);
+        return 0;
+    }
+
+    std::lock_guard<InterpreterMutex> lock(timerMutex);
+    return timers.Schedule(delay, period, ScheduledCall{callback, currentOwner});
+}
+
+bool PythonEngine::CancelTimer(uint64 handle)
+{
+    std::optional<ScheduledCall> cancelled;
+
+    {
+        std::lock_guard<InterpreterMutex> lock(timerMutex);
+        cancelled = timers.Cancel(handle);
+    }
+
+    // Released outside of timerMutex: finalizers may switch threads
+    return cancelled.has_value();
+}
+
+void PythonEngine::AddCallback(HookInfo hinfo, uint32 entryId, HookCallback callback,
+                               BatchSubscription const* subscription)
+{
+    {
+        std::lock_guard<InterpreterMutex> lock(registryMutex);
+
+        pendingHookMap.Add(hinfo, entryId, std::move(callback));
+        if (subscription)
+            batches.push_back(*subscription);
+
+        // Inside LoadScripts all hooks are published at once
+        if (!registrationBatch)
+            PublishHooks();
+    }
+
+    ReclaimHooks();
+}
+
+void PythonEngine::AppendBatch(HookInfo hinfo, ObjectGuid source, ObjectGuid target, int64 amount, uint32 spellId)
+{
+    // Acquire: see hook modifications
+    if (!enabled.load(std::memory_order_acquire) || reloading.load(std::memory_order_acquire))
+        return;
+
+    HookSnapshot::ReadGuard registry(hookMap);
+    HookRegistry::Slot const* slot = registry ? registry->Find(hinfo) : nullptr;
+    if (!slot)
+        return;
+
+    uint32 now = 0;
+    for (auto const& callback : slot->global)
+    {
+        if (!callback.batch)
+            continue;
+
+        if (!now)
+            now = getMSTime();
+
+        callback.batch->Append(source, target, amount, spellId, now);
+    }
+}
+
 ExecutionResult PythonEngine::ExecuteCode(std::string const& code)
 {
     // Acquire: see initialization
@@ -205,9 +987,7 @@ ExecutionResult PythonEngine::ExecuteCode(std::string const& code)
     if (triggerDepth > 0)
         return ExecutionResult::Error("Cannot execute while hooks are running");
 
-    // Try to acquire exclusive lock
-    std::unique_lock<std::shared_mutex> lock(hookMutex, std::defer_lock);
-    if (!lock.try_lock())
+    if (reloading.load(std::memory_order_acquire))
         return ExecutionResult::Error("Python engine is busy");
 
     GILGuard gil;
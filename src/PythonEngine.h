@@ -4,15 +4,31 @@
 #include "PythonAPI.h"
 #include "PythonConverter.h"
 #include "PythonGIL.h"
+#include "PythonMutex.h"
+#include "PythonEvent.h"
 #include "ExceptionHelper.h"
 #include "ExecutionResult.h"
+#include "CallbackFilter.h"
+#include "DeferredCall.h"
+#include "HookBatch.h"
+#include "HookThrottle.h"
 #include "HookInfo.h"
+#include "HookTable.h"
+#include "MpscRing.h"
+#include "RcuPointer.h"
+#include "TimingWheel.h"
 #include "Define.h"
 #include "Log.h"
+#include <array>
 #include <atomic>
-#include <shared_mutex>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 // Forward declaration
@@ -46,18 +62,86 @@ public:
     void LoadScripts();
 
     /**
-     * @brief Clear all registered hooks with proper locking and GIL
+     * @brief Advances the world tick, runs queued async callbacks, due timers and woken coroutines
+     *
+     * Called once per world update, while no map is being updated.
+     *
+     * @param diff Time since last update in milliseconds
+     */
+    void Update(uint32 diff);
+
+    /**
+     * @brief Current world tick, used to expire per-tick caches
+     */
+    [[nodiscard]] uint32 GetWorldTick() const noexcept
+    {
+        return worldTick.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Clear all registered hooks (publishes an empty registry)
      */
     void ClearHooks();
 
     /**
      * @brief Registers Python callback for the game event hook
      *
+     * Safe to call from inside an event handler: the change is applied to a
+     * writer-side copy and published as a new registry snapshot.
+     *
      * @param eventName Hook event name (ex., "PLAYER_ON_LOGIN")
      * @param callback Python callable object
      * @param entryId Specific entry ID (creature, item, etc.; 0 = global)
+     * @param flags HookFlag bits (HOOK_FLAG_ASYNC: deferred to the world update)
+     * @param filter Scope and guards tested on the player argument (sync callbacks only)
+     * @param interval Minimum time between calls per object in milliseconds (INTERVAL_HOOKS only, 0 = every event)
+     */
+    void RegisterHook(std::string const& eventName, API::Object callback, uint32 entryId = 0, uint32 flags = 0,
+                      PyEng::Hooks::CallbackFilter const& filter = {}, uint32 interval = 0);
+
+    /**
+     * @brief Registers Python callback receiving events of the hook in batches
+     *
+     * Events are collected into columns (source GUID, target GUID, amount,
+     * spell id, timestamp) and passed once per interval as typed memoryviews.
+     *
+     * @param eventName Hook event name, one of BATCH_HOOKS (ex., "UNIT_ON_DAMAGE")
+     * @param callback Python callable object
+     * @param interval Delivery interval in milliseconds
+     */
+    void RegisterBatch(std::string const& eventName, API::Object callback, uint32 interval);
+
+    /**
+     * @brief Schedules a Python callback on the world thread
+     *
+     * Timers set while a script file executes are owned by it: they are
+     * cancelled if the file fails to load. All timers are dropped by
+     * ClearHooks().
+     *
+     * @param callback Python callable taking no arguments
+     * @param delay Time until the first call in milliseconds
+     * @param period Time between calls of a repeating timer in milliseconds (0 = called once)
+     * @return Timer handle, 0 if the timer was rejected
+     */
+    uint64 ScheduleTimer(API::Object callback, uint32 delay, uint32 period = 0);
+
+    /**
+     * @brief Cancels a pending timer (safe from its own callback)
+     *
+     * @param handle Handle returned by ScheduleTimer()
+     * @return False if the timer already ran (one-shot) or was cancelled
+     */
+    bool CancelTimer(uint64 handle);
+
+    /**
+     * @brief Cancels the coroutines started by events of a game object (any thread)
+     *
+     * Called when the object leaves the world. The GIL is not taken: the
+     * coroutines are closed at the next world update and never resumed.
+     *
+     * @param guid Object leaving the world
      */
-    void RegisterHook(std::string const& eventName, API::Object callback, uint32 entryId = 0);
+    void CancelCoroutines(ObjectGuid guid);
 
     /**
      * @brief Executes arbitrary Python code string
@@ -138,6 +222,8 @@ public:
      *
      * When a specific game event occurs (ex., player login, creature death),
      * this method looks up all registered Python callbacks and executes them.
+     * Async callbacks are not run here: a value snapshot of the arguments is
+     * queued for the next world update instead.
      *
      * @param hinfo Hook identifier to trigger
      * @param entryId Specific entry ID (creature, item, etc.; 0 = global)
@@ -146,36 +232,138 @@ public:
     template<typename... Args>
     void Trigger(HookInfo hinfo, uint32 entryId, Args&&... args)
     {
-        // Acquire reloading flag to ensure we see hook modifications.
-        // NOTE: Could use relaxed here since hookMutex provides synchronization,
-        // but acquire is safer and the cost is negligible.
-        if (!enabled.load(std::memory_order_acquire) || reloading.load(std::memory_order_acquire))
-            return;
+        TriggerUntil<Args...>(hinfo, entryId, std::nullopt, std::forward<Args>(args)...);
+    }
 
-        std::shared_lock<std::shared_mutex> lock(hookMutex);
+    /**
+     * @brief Triggers a hook whose callbacks answer a question (CAN_*, gossip)
+     *
+     * Callbacks run in registration order (global, then entry) until one
+     * returns the opposite of result: that answer is returned and the
+     * remaining callbacks are skipped. Returning None keeps the default.
+     * Async callbacks are queued as usual, they cannot answer.
+     *
+     * @param hinfo Hook identifier to trigger
+     * @param entryId Specific entry ID (creature, item, etc.; 0 = global)
+     * @param result Default answer (ex., true for CAN_* hooks: allowed unless vetoed)
+     * @param args Variadic arguments to pass to Python callbacks
+     * @return Answer of the first deciding callback, otherwise result
+     */
+    template<typename... Args>
+    bool TriggerPredicate(HookInfo hinfo, uint32 entryId, bool result, Args&&... args)
+    {
+        return TriggerUntil<Args...>(hinfo, entryId, !result, std::forward<Args>(args)...) ? !result : result;
+    }
 
-        // CRITICAL: Double-check reloading and bindings after acquiring lock.
-        // Prevent race conditions with reload scripts operations.
-        if (reloading.load(std::memory_order_acquire) || !HasBindingsFor(hinfo, entryId))
-            return;
+    /**
+     * @brief Appends an event to the batch subscriptions of the hook
+     *
+     * No GIL: only the registry snapshot and the batch buffers are touched.
+     *
+     * @param hinfo Batched hook (see BATCH_HOOKS)
+     * @param source Attacker or healer
+     * @param target Victim or healed unit
+     * @param amount Damage or heal amount
+     * @param spellId Spell of the event, 0 if none (melee, hook without spell)
+     */
+    void AppendBatch(HookInfo hinfo, ObjectGuid source, ObjectGuid target, int64 amount, uint32 spellId);
 
-        TriggerDepthGuard depthGuard;
+    static void TriggerHook(HookInfo* hinfo, uint32 entryId);
 
-        auto itr = hookMap.find(hinfo);
-        if (itr == hookMap.end())
-            return;
+private:
+    /**
+     * @brief How a callback receives its events
+     */
+    enum class Dispatch : uint8
+    {
+        Sync,  // in place, on the triggering thread
+        Async, // value snapshot, next world update
+        Batch,    // columns, once per interval
+        Interval, // in place, once per interval and object
+        Wake,     // resumes a coroutine at the next world update
+    };
 
-        TriggerCallbacks(itr->second, 0, std::forward<Args>(args)...);
-        if (entryId > 0)
-            TriggerCallbacks(itr->second, entryId, std::forward<Args>(args)...);
-    }
+    /**
+     * @brief Hook waiter of a coroutine suspended in wait_for
+     *
+     * Set once, by the first trigger or by the timeout, without the GIL.
+     */
+    struct CoroutineWake
+    {
+        explicit CoroutineWake(uint64 task) : task(task) {}
 
-    static void TriggerHook(HookInfo* hinfo, uint32 entryId);
+        uint64 task;
+        std::atomic<bool> fired{false};
+    };
 
-private:
-    using CallbackList = std::vector<API::Object>;
-    using HookEntryMap = std::unordered_map<uint32, CallbackList>;
-    using HookRegistry = std::unordered_map<HookInfo, HookEntryMap>;
+    /**
+     * @brief Registered Python callable with its HookFlag bits
+     */
+    struct HookCallback
+    {
+        API::Object callable;
+        uint32 flags = 0;
+        std::shared_ptr<PyEng::Hooks::HookBatch> batch;       // HOOK_FLAG_BATCH only
+        PyEng::Hooks::CallbackFilter filter;                  // empty: every event
+        std::shared_ptr<PyEng::Hooks::HookThrottle> throttle; // HOOK_FLAG_INTERVAL only
+        std::shared_ptr<CoroutineWake> wake;                  // HOOK_FLAG_WAKE only
+
+        [[nodiscard]] Dispatch GetDispatch() const noexcept
+        {
+            if (flags & PyEng::Hooks::HOOK_FLAG_BATCH)
+                return Dispatch::Batch;
+
+            if (flags & PyEng::Hooks::HOOK_FLAG_WAKE)
+                return Dispatch::Wake;
+
+            if (flags & PyEng::Hooks::HOOK_FLAG_INTERVAL)
+                return Dispatch::Interval;
+
+            return flags & PyEng::Hooks::HOOK_FLAG_ASYNC ? Dispatch::Async : Dispatch::Sync;
+        }
+
+        [[nodiscard]] bool IsLazy() const noexcept { return flags & PyEng::Hooks::HOOK_FLAG_LAZY; }
+    };
+
+    /**
+     * @brief Batch subscription, flushed from Update()
+     */
+    struct BatchSubscription
+    {
+        HookInfo hinfo;
+        API::Object callable;
+        std::shared_ptr<PyEng::Hooks::HookBatch> batch;
+    };
+
+    /**
+     * @brief Python callable armed in the timing wheel
+     */
+    struct ScheduledCall
+    {
+        API::Object callable;
+        uint32 owner = 0;     // index + 1 in timerOwners, 0 if not set by a loading script
+        uint64 coroutine = 0; // suspended coroutine resumed instead of calling callable
+    };
+
+    /**
+     * @brief Coroutine returned by a callback, stepped from the world update
+     */
+    struct CoroutineTask
+    {
+        API::Object coroutine;
+        uint64 owner = 0;                    // GUID raw value cancelling it, 0 if none
+        uint64 timer = 0;                    // sleep or wait_for timeout, 0 if none
+        std::shared_ptr<CoroutineWake> wake; // wait_for only
+        bool cancelled = false;              // guarded by coroutineMutex
+    };
+
+    using HookRegistry = PyEng::Hooks::HookTable<HookCallback>;
+    using CallbackList = HookRegistry::CallbackList;
+    using HookSnapshot = PyEng::Utilities::RcuPointer<HookRegistry>;
+    using DeferredCall = PyEng::Hooks::DeferredCall;
+    using DeferredQueue = PyEng::Utilities::MpscRing<DeferredCall>;
+    using FilterSubject = PyEng::Hooks::FilterSubject;
+    using TimerWheel = PyEng::Utilities::TimingWheel<ScheduledCall>;
 
     PythonEngine() = default;
     ~PythonEngine();
@@ -189,62 +377,448 @@ private:
         TriggerDepthGuard& operator=(TriggerDepthGuard const&) = delete;
     };
 
+    // RAII guard deferring snapshot publication of registered hooks
+    struct RegistrationBatch
+    {
+        explicit RegistrationBatch(PythonEngine& engine) : engine(engine) { engine.BeginRegistration(); }
+        ~RegistrationBatch() { engine.EndRegistration(); }
+        RegistrationBatch(RegistrationBatch const&) = delete;
+        RegistrationBatch& operator=(RegistrationBatch const&) = delete;
+
+        PythonEngine& engine;
+    };
+
     /**
-     * @brief Checks if any callbacks are registered for specific hook
+     * @brief Defers publication until the outermost EndRegistration
+     */
+    void BeginRegistration();
+
+    /**
+     * @brief Publishes pending hooks when the outermost batch ends
+     */
+    void EndRegistration();
+
+    /**
+     * @brief Publishes a copy of pending hooks (requires registryMutex and GIL)
+     */
+    void PublishHooks();
+
+    /**
+     * @brief Destroys retired snapshots no longer observed (requires GIL)
+     */
+    void ReclaimHooks();
+
+    /**
+     * @brief Adds callback to the pending registry and publishes it (requires GIL)
      *
-     * @param hinfo Hook identifier to check
-     * @param entryId Specific entry ID (creature, item, etc.; 0 = global)
-     * @return True if callbacks registered, false otherwise
+     * @param subscription Batch subscription to add as well, or nullptr
+     */
+    void AddCallback(HookInfo hinfo, uint32 entryId, HookCallback callback, BatchSubscription const* subscription);
+
+    template<std::size_t N>
+    using ArgumentList = std::array<API::Object, N>;
+
+    /**
+     * @brief Runs the sync callbacks of the hook, queues the async ones
+     *
+     * @param stopOn Result stopping the dispatch (std::nullopt: results ignored)
+     * @return True if a callback returned stopOn
      */
-    [[nodiscard]] bool HasBindingsFor(HookInfo hinfo, uint32 entryId = 0) const noexcept
+    template<typename... Args>
+    bool TriggerUntil(HookInfo hinfo, uint32 entryId, std::optional<bool> stopOn, Args&&... args)
     {
-        auto itr = hookMap.find(hinfo);
-        if (itr == hookMap.end())
+        // Acquire reloading flag to ensure we see hook modifications.
+        if (!enabled.load(std::memory_order_acquire) || reloading.load(std::memory_order_acquire))
             return false;
 
-        auto callbacks = [&](uint32 id)
-        {
-            auto it = itr->second.find(id);
-            return it != itr->second.end() && !it->second.empty();
-        };
+        // Lock-free: pins the current registry snapshot until this Trigger
+        // returns. Writers never wait for readers, old snapshots are retired.
+        HookSnapshot::ReadGuard registry(hookMap);
+        if (!registry)
+            return false;
+
+        // Dense table lookup: one array read for the hook, then a bitmap test
+        // for the entry; only scripted entries reach the binary search
+        HookRegistry::Slot const* slot = registry->Find(hinfo);
+        if (!slot)
+            return false;
+
+        CallbackList const* entryCallbacks = entryId > 0 ? slot->FindEntry(entryId) : nullptr;
+        if (slot->global.empty() && !entryCallbacks)
+            return false;
+
+        // Coroutines suspended in wait_for are resumed at the next world update
+        if (HasCallbacks(&slot->global, Dispatch::Wake) || HasCallbacks(entryCallbacks, Dispatch::Wake))
+            WakeCoroutines(&slot->global, entryCallbacks);
+
+        // Registration rejects async callbacks for hooks without value snapshots
+        if constexpr ((PyEng::Hooks::DeferredValue<Args>::Supported && ...))
+            if (HasCallbacks(&slot->global, Dispatch::Async) || HasCallbacks(entryCallbacks, Dispatch::Async))
+                Defer<Args...>(hinfo, entryId, args...);
+
+        // Callback filters are tested on the player argument, still without the GIL;
+        // it is only read if a callback of the hook is filtered
+        FilterSubject subject;
+        if constexpr (PyEng::Hooks::HasFilterSubject<Args...>)
+            if (slot->hasFilters)
+                subject = FilterSubject::Of(args...);
+
+        // Interval hooks are global only, registration rejects entries
+        if constexpr (PyEng::Hooks::IsIntervalSignature<Args...>)
+            if (HasCallbacks(&slot->global, Dispatch::Interval, subject))
+                TriggerIntervals(hinfo, slot->global, subject, args...);
+
+        if (!HasCallbacks(&slot->global, Dispatch::Sync, subject) &&
+            !HasCallbacks(entryCallbacks, Dispatch::Sync, subject))
+            return false;
+
+        TriggerDepthGuard depthGuard;
 
-        return callbacks(0) || (entryId > 0 && callbacks(entryId));
+        // One GIL acquisition covers both the global and the entry pass
+        GILGuard gil;
+
+        // Arguments are converted at most once and shared by every callback
+        EventArguments<Args...> arguments(hinfo, std::forward<Args>(args)...);
+
+        bool stopped = TriggerCallbacks(hinfo, slot->global, arguments, Dispatch::Sync, subject, stopOn);
+        if (!stopped && entryCallbacks)
+            stopped = TriggerCallbacks(hinfo, *entryCallbacks, arguments, Dispatch::Sync, subject, stopOn);
+
+        // By-reference arguments (MutableValue) see the last assigned value
+        arguments.WriteBack();
+        return stopped;
+    }
+
+    /**
+     * @brief Checks for callbacks of the dispatch mode (flags and filters only, no GIL needed)
+     */
+    static bool HasCallbacks(CallbackList const* callbacks, Dispatch dispatch,
+                             FilterSubject const& subject = {}) noexcept
+    {
+        if (callbacks)
+            for (auto const& callback : *callbacks)
+                if (callback.GetDispatch() == dispatch && callback.filter.Matches(subject))
+                    return true;
+
+        return false;
     }
 
     /**
-     * @brief Executes all registered Python callbacks for specific hook
+     * @brief Executes registered Python callbacks for specific hook
      *
-     * @param entryMap Map of entity IDs to callback vectors
-     * @param entryId Specific entry ID (creature, item, etc.; 0 = global)
-     * @param args Variadic arguments to pass to Python callbacks
+     * Requires the GIL to be held by the caller. Lazy callbacks receive the
+     * pooled event object, the others all converted arguments. A callback
+     * raising an exception gives no answer, nor does a coroutine (async def),
+     * which runs here until its first await and is then owned by the engine.
+     *
+     * @param hinfo Triggered hook (for diagnostics)
+     * @param callbacks Callbacks bound to the hook (global or entry)
+     * @param arguments Arguments of the dispatch, converted on demand
+     * @param dispatch Runs only the callbacks of this dispatch mode
+     * @param subject Player fields of the dispatch, skips callbacks filtered out
+     * @param stopOn Result stopping the dispatch (std::nullopt: results ignored)
+     * @return True if a callback returned stopOn
      */
     template<typename... Args>
-    void TriggerCallbacks(HookEntryMap const& entryMap, uint32 entryId, Args&&... args)
+    bool TriggerCallbacks(HookInfo hinfo, CallbackList const& callbacks, EventArguments<Args...>& arguments,
+                          Dispatch dispatch, FilterSubject const& subject = {},
+                          std::optional<bool> stopOn = std::nullopt)
     {
-        auto itr = entryMap.find(entryId);
-        if (itr == entryMap.end())
-            return;
-
-        GILGuard gil;
-        for (auto const& callback : itr->second)
+        for (auto const& callback : callbacks)
         {
+            if (callback.GetDispatch() != dispatch || !callback.filter.Matches(subject))
+                continue;
+
             try
             {
-                callback(Converter::ToPython(args)...);
+                API::Object result = callback.IsLazy()
+                                         ? Invoke(callback.callable, ArgumentList<1>{arguments.GetEvent()})
+                                         : Invoke(callback.callable, arguments.GetAll());
+
+                if (SpawnCoroutine(result, arguments.GetOwner()))
+                    continue;
+
+                if (stopOn && API::ToPredicate(result) == stopOn)
+                    return true;
             }
             catch (...)
             {
+                LOG_ERROR("module.python", "Error in '{}' callback", GetHookName(hinfo));
                 LOG_ERROR("module.python", "{}", ExceptionHelper::Format());
             }
         }
+
+        return false;
+    }
+
+    /**
+     * @brief Advances the throttles of interval callbacks, runs the due ones
+     *
+     * Accumulators are advanced without the GIL; it is only taken if an
+     * interval elapsed. Due callbacks get the diff accumulated for the
+     * object in place of the tick diff.
+     *
+     * @param args Hook arguments: ([object*,] uint32 diff)
+     */
+    template<typename... Args>
+    void TriggerIntervals(HookInfo hinfo, CallbackList const& callbacks, FilterSubject const& subject,
+                          Args const&... args)
+    {
+        using Throttle = PyEng::Hooks::HookThrottle;
+
+        uint64 key = Throttle::KeyOf(args...);
+        uint32 diff = Throttle::DiffOf(args...);
+        uint32 tick = GetWorldTick();
+
+        // Empty unless an interval elapsed, so the steady state does not allocate
+        std::vector<std::pair<HookCallback const*, uint32>> due;
+        for (auto const& callback : callbacks)
+            if (callback.GetDispatch() == Dispatch::Interval && callback.filter.Matches(subject))
+                if (uint32 elapsed = callback.throttle->Advance(key, diff, tick))
+                    due.emplace_back(&callback, elapsed);
+
+        if (due.empty())
+            return;
+
+        TriggerDepthGuard depthGuard;
+        GILGuard gil;
+
+        for (auto const& [callback, elapsed] : due)
+        {
+            if constexpr (sizeof...(Args) == 1)
+                RunInterval(hinfo, *callback, elapsed);
+            else
+                RunInterval(hinfo, *callback, std::get<0>(std::tie(args...)), elapsed);
+        }
+    }
+
+    /**
+     * @brief Runs one due interval callback (requires GIL)
+     */
+    template<typename... Values>
+    void RunInterval(HookInfo hinfo, HookCallback const& callback, Values... values)
+    {
+        EventArguments<Values...> arguments(hinfo, std::move(values)...);
+
+        try
+        {
+            API::Object result = callback.IsLazy() ? Invoke(callback.callable, ArgumentList<1>{arguments.GetEvent()})
+                                                   : Invoke(callback.callable, arguments.GetAll());
+
+            SpawnCoroutine(result, arguments.GetOwner());
+        }
+        catch (...)
+        {
+            LOG_ERROR("module.python", "Error in '{}' callback", GetHookName(hinfo));
+            LOG_ERROR("module.python", "{}", ExceptionHelper::Format());
+        }
+    }
+
+    /**
+     * @brief Name of the hook for log messages (reverse name table lookup)
+     */
+    static std::string_view GetHookName(HookInfo hinfo);
+
+    /**
+     * @brief Invokes a single callback (vectorcall when enabled and supported)
+     *
+     * Callables without a vectorcall slot (ex., objects defining __call__)
+     * go through the generic Boost.Python call operator.
+     */
+    template<std::size_t N>
+    API::Object Invoke(API::Object const& callback, ArgumentList<N> const& pyArgs) const
+    {
+        if (useVectorcall && API::HasVectorcall(callback))
+            return API::Vectorcall(callback, pyArgs);
+
+        return API::Call(callback, pyArgs);
+    }
+
+    /**
+     * @brief Queues a value snapshot of the arguments for RunDeferredCalls
+     *
+     * Lock-free and GIL-free; the call is dropped (and counted) if the queue
+     * is full.
+     */
+    template<typename... Args, typename... CallArgs>
+    void Defer(HookInfo hinfo, uint32 entryId, CallArgs const&... args)
+    {
+        using Values = std::tuple<typename PyEng::Hooks::DeferredValue<Args>::Type...>;
+
+        bool queued = deferredCalls &&
+                      deferredCalls->TryPush(hinfo, entryId, deferredGeneration.load(std::memory_order_relaxed),
+                                             &PythonEngine::DispatchDeferred<Values>,
+                                             Values(PyEng::Hooks::DeferredValue<Args>::Capture(args)...));
+        if (!queued)
+            droppedCalls.fetch_add(1, std::memory_order_relaxed);
     }
 
+    /**
+     * @brief Restores the typed values of a queued call and runs it
+     */
+    template<typename Values>
+    static void DispatchDeferred(void* context, DeferredCall const& call)
+    {
+        static_cast<PythonEngine*>(context)->RunDeferred(call.GetHook(), call.GetEntry(),
+                                                         call.GetValues<Values>());
+    }
+
+    /**
+     * @brief Runs the async callbacks of the hook (requires GIL)
+     *
+     * Callbacks are looked up in the current registry snapshot, world
+     * objects are passed as ObjectHandle.
+     */
+    template<typename... Values>
+    void RunDeferred(HookInfo hinfo, uint32 entryId, std::tuple<Values...> const& values)
+    {
+        HookSnapshot::ReadGuard registry(hookMap);
+        HookRegistry::Slot const* slot = registry ? registry->Find(hinfo) : nullptr;
+        if (!slot)
+            return;
+
+        CallbackList const* entryCallbacks = entryId > 0 ? slot->FindEntry(entryId) : nullptr;
+
+        // Guaranteed elision: EventArguments is neither copied nor moved
+        auto arguments = std::apply(
+            [hinfo](auto const&... value) { return EventArguments<decltype(value)...>(hinfo, value...); }, values);
+
+        TriggerCallbacks(hinfo, slot->global, arguments, Dispatch::Async);
+        if (entryCallbacks)
+            TriggerCallbacks(hinfo, *entryCallbacks, arguments, Dispatch::Async);
+    }
+
+    /**
+     * @brief Drains the async queue under a single GIL acquisition
+     *
+     * Called from Update() only (the single consumer of the queue).
+     */
+    void RunDeferredCalls();
+
+    /**
+     * @brief Delivers the batches whose interval elapsed (world thread)
+     *
+     * The GIL is only acquired if at least one batch is due.
+     *
+     * @param diff Time since last update in milliseconds
+     */
+    void FlushBatches(uint32 diff);
+
+    /**
+     * @brief Advances the timing wheel and runs the due timers (world thread)
+     *
+     * The GIL is only acquired if at least one timer expired, then once for
+     * all of them.
+     *
+     * @param diff Time since last update in milliseconds
+     */
+    void FireTimers(uint32 diff);
+
+    /**
+     * @brief Takes ownership of a coroutine returned by a callback and starts it (requires GIL)
+     *
+     * @param result Callback result
+     * @param owner GUID raw value of the object the event is about (0: never cancelled)
+     * @return False if the result is not a coroutine
+     */
+    bool SpawnCoroutine(API::Object const& result, uint64 owner);
+
+    /**
+     * @brief Steps a coroutine until it awaits again or returns (requires GIL)
+     *
+     * @param value Result of the awaited expression
+     */
+    void ResumeCoroutine(uint64 id, API::Object const& value);
+
+    /**
+     * @brief Parks a suspended coroutine on what it awaits (requires GIL)
+     *
+     * @param awaited Object yielded by the coroutine
+     * @return False if it awaited something else than sleep or wait_for
+     */
+    bool ParkCoroutine(uint64 id, CoroutineTask& task, API::Object const& awaited);
+
+    /**
+     * @brief Closes and forgets a coroutine, disarming its timer and waiter (requires GIL)
+     */
+    void EraseCoroutine(uint64 id);
+
+    /**
+     * @brief Resumes the coroutine of an expired sleep or wait_for timeout (requires GIL)
+     */
+    void ExpireCoroutineTimer(uint64 id);
+
+    /**
+     * @brief Queues the coroutines waiting for the triggered hook (no GIL needed)
+     */
+    void WakeCoroutines(CallbackList const* global, CallbackList const* entry);
+
+    /**
+     * @brief Closes cancelled coroutines and resumes woken ones (world thread)
+     *
+     * The GIL is only acquired if there is something to do.
+     */
+    void RunCoroutines();
+
+    /**
+     * @brief Closes all coroutines (requires GIL)
+     */
+    void ClearCoroutines();
+
+    /**
+     * @brief Cancels the timers set by a script file (requires GIL)
+     */
+    void CancelOwnedTimers(uint32 owner);
+
+    /**
+     * @brief Script file that set the timer, for diagnostics (requires GIL)
+     */
+    std::string_view GetTimerOwner(uint32 owner) const;
+
     std::atomic<bool> enabled{false};
     std::atomic<bool> reloading{false};
-    mutable std::shared_mutex hookMutex;
+    std::atomic<uint32> worldTick{1};
+    bool useVectorcall = true; // Python.Dispatch.Vectorcall, set on Initialize
     inline static thread_local int triggerDepth = 0;
 
-    HookRegistry hookMap;
+    // Readers: hookMap (lock-free snapshot). Writers: pendingHookMap is the
+    // master copy, guarded by registryMutex (always acquired after the GIL;
+    // free-threaded builds detach while waiting for it, see InterpreterMutex)
+    HookSnapshot hookMap;
+    HookRegistry pendingHookMap;
+    InterpreterMutex registryMutex;
+    uint32 registrationBatch = 0;
+
+    // Async callbacks: producers are the triggering threads, the consumer is
+    // the world thread. Calls queued before ClearHooks are skipped by generation
+    std::unique_ptr<DeferredQueue> deferredCalls;
+    std::atomic<uint32> deferredGeneration{0};
+    std::atomic<uint64> droppedCalls{0};
+
+    // Batch subscriptions (guarded by registryMutex); their buffers are also
+    // referenced from the registry snapshots for AppendBatch
+    std::vector<BatchSubscription> batches;
+
+    // Script timers, guarded by timerMutex (always acquired after the GIL).
+    // Owners are the script files loaded since the last ClearHooks (GIL).
+    // The current owner is set by the thread loading scripts or firing
+    // timers; timers set from any other thread belong to the runtime
+    TimerWheel timers;
+    InterpreterMutex timerMutex;
+    std::vector<TimerWheel::Handle> expiredTimers; // world thread only
+    std::vector<std::string> timerOwners;
+    inline static thread_local uint32 currentOwner = 0;
+
+    // Coroutines: the table is guarded by coroutineMutex (always acquired
+    // after the GIL), their Python objects by the GIL. Tasks are indexed by
+    // owner GUID for CancelCoroutines, which runs without the GIL
+    std::unordered_map<uint64, CoroutineTask> coroutines;
+    std::unordered_map<uint64, std::vector<uint64>> coroutinesByOwner;
+    std::vector<std::pair<uint64, bool>> readyCoroutines; // woken by a hook (true) or cancelled (false)
+    InterpreterMutex coroutineMutex;
+    std::atomic<std::size_t> ownedCoroutines{0};
+    std::atomic<bool> staleWakes{false}; // fired waiters left in the registry
+    uint64 lastCoroutineId = 0;
     API::Object main_namespace;
 };
 
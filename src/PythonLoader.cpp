@@ -1,5 +1,7 @@
 #include "AutoRegistryMgr.h"
 #include "PythonEngine.h"
+#include "HookMacros.h"
+#include "ScriptHookGate.h"
 #include "ScriptMgr.h"
 
 // Create Scripts scope for the forwards
@@ -12,6 +14,8 @@ REGISTER_TO_SCOPE(Scripts, AddSC_PythonCreatureScripts);
 REGISTER_TO_SCOPE(Scripts, AddSC_PythonGameObjectScripts);
 REGISTER_TO_SCOPE(Scripts, AddSC_PythonItemScripts);
 REGISTER_TO_SCOPE(Scripts, AddSC_PythonPlayerScripts);
+REGISTER_TO_SCOPE(Scripts, AddSC_PythonServerScripts);
+REGISTER_TO_SCOPE(Scripts, AddSC_PythonUnitScripts);
 
 class PythonLoader : public WorldScript
 {
@@ -34,6 +38,16 @@ public:
         sPythonEngine->LoadScripts();
     }
 
+    void OnUpdate(uint32 diff) override
+    {
+        sPythonEngine->Update(diff);
+
+        TRIGGER_WORLD_HOOK(ON_UPDATE, diff);
+
+        // Maps are idle here: apply subscription changes to core script hooks
+        PyEng::Scripts::ScriptHookGates::Refresh();
+    }
+
     void OnAfterUnloadAllMaps() override
     {
         // Ensure the Python engine is turned off safely, preventing memory
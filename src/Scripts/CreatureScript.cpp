@@ -25,8 +25,7 @@ public:
      */
     bool OnGossipHello(Player* player, Creature* creature) override
     {
-        TRIGGER_CREATURE_HOOK(ON_GOSSIP_HELLO, creature->GetEntry(), player, creature);
-        return false;
+        return TRIGGER_CREATURE_PREDICATE(ON_GOSSIP_HELLO, creature->GetEntry(), false, player, creature);
     }
 
     /**
@@ -40,8 +39,8 @@ public:
      */
     bool OnGossipSelect(Player* player, Creature* creature, uint32 sender, uint32 action) override
     {
-        TRIGGER_CREATURE_HOOK(ON_GOSSIP_SELECT, creature->GetEntry(), player, creature, sender, action);
-        return false;
+        return TRIGGER_CREATURE_PREDICATE(ON_GOSSIP_SELECT, creature->GetEntry(), false, player, creature, sender,
+                                          action);
     }
 
     /**
@@ -56,8 +55,8 @@ public:
      */
     bool OnGossipSelectCode(Player* player, Creature* creature, uint32 sender, uint32 action, char const* code) override
     {
-        TRIGGER_CREATURE_HOOK(ON_GOSSIP_SELECT_CODE, creature->GetEntry(), player, creature, sender, action, code);
-        return false;
+        return TRIGGER_CREATURE_PREDICATE(ON_GOSSIP_SELECT_CODE, creature->GetEntry(), false, player, creature, sender,
+                                          action, code);
     }
 
     /**
@@ -70,8 +69,7 @@ public:
      */
     bool OnQuestAccept(Player* player, Creature* creature, Quest const* quest) override
     {
-        TRIGGER_CREATURE_HOOK(ON_QUEST_ACCEPT, creature->GetEntry(), player, creature, quest);
-        return false;
+        return TRIGGER_CREATURE_PREDICATE(ON_QUEST_ACCEPT, creature->GetEntry(), false, player, creature, quest);
     }
 
     /**
@@ -84,8 +82,7 @@ public:
      */
     bool OnQuestSelect(Player* player, Creature* creature, Quest const* quest) override
     {
-        TRIGGER_CREATURE_HOOK(ON_QUEST_SELECT, creature->GetEntry(), player, creature, quest);
-        return false;
+        return TRIGGER_CREATURE_PREDICATE(ON_QUEST_SELECT, creature->GetEntry(), false, player, creature, quest);
     }
 
     /**
@@ -98,8 +95,7 @@ public:
      */
     bool OnQuestComplete(Player* player, Creature* creature, Quest const* quest) override
     {
-        TRIGGER_CREATURE_HOOK(ON_QUEST_COMPLETE, creature->GetEntry(), player, creature, quest);
-        return false;
+        return TRIGGER_CREATURE_PREDICATE(ON_QUEST_COMPLETE, creature->GetEntry(), false, player, creature, quest);
     }
 
     /**
@@ -113,8 +109,7 @@ public:
      */
     bool OnQuestReward(Player* player, Creature* creature, Quest const* quest, uint32 opt) override
     {
-        TRIGGER_CREATURE_HOOK(ON_QUEST_REWARD, creature->GetEntry(), player, creature, quest, opt);
-        return false;
+        return TRIGGER_CREATURE_PREDICATE(ON_QUEST_REWARD, creature->GetEntry(), false, player, creature, quest, opt);
     }
 };
 
@@ -141,6 +136,11 @@ public:
     void OnCreatureRemoveWorld(Creature* creature) override
     {
         TRIGGER_CREATURE_HOOK(ON_REMOVE_WORLD, creature->GetEntry(), creature);
+
+        // Creature may be deleted once out of the world, neuter its Python proxy
+        // and stop the coroutines started by its events
+        ProxyCache::Invalidate(creature->GetGUID());
+        sPythonEngine->CancelCoroutines(creature->GetGUID());
     }
 };
 
@@ -25,8 +25,7 @@ public:
      */
     bool OnGossipHello(Player* player, GameObject* go) override
     {
-        TRIGGER_GAMEOBJECT_HOOK(ON_GOSSIP_HELLO, go->GetEntry(), player, go);
-        return false;
+        return TRIGGER_GAMEOBJECT_PREDICATE(ON_GOSSIP_HELLO, go->GetEntry(), false, player, go);
     }
 
     /**
@@ -40,8 +39,7 @@ public:
      */
     bool OnGossipSelect(Player* player, GameObject* go, uint32 sender, uint32 action) override
     {
-        TRIGGER_GAMEOBJECT_HOOK(ON_GOSSIP_SELECT, go->GetEntry(), player, go, sender, action);
-        return false;
+        return TRIGGER_GAMEOBJECT_PREDICATE(ON_GOSSIP_SELECT, go->GetEntry(), false, player, go, sender, action);
     }
 
     /**
@@ -52,7 +50,7 @@ public:
      */
     void OnDestroyed(GameObject* go, Player* player) override
     {
-        TRIGGER_GAMEOBJECT_HOOK(ON_REMOVE_WORLD, go->GetEntry(), go, player);
+        TRIGGER_GAMEOBJECT_HOOK(ON_DESTROYED, go->GetEntry(), go, player);
     }
 
     /**
@@ -63,11 +61,43 @@ public:
      */
     void OnDamaged(GameObject* go, Player* player) override
     {
-        TRIGGER_GAMEOBJECT_HOOK(ON_ADD_WORLD, go->GetEntry(), go, player);
+        TRIGGER_GAMEOBJECT_HOOK(ON_DAMAGED, go->GetEntry(), go, player);
+    }
+};
+
+class PythonAllGameObjectScript : public AllGameObjectScript
+{
+public:
+    PythonAllGameObjectScript() : AllGameObjectScript("PythonAllGameObjectScript") {}
+
+    /**
+     * @brief This hook runs after adding a GameObject to the world
+     *
+     * @param go Contains information about the GameObject
+     */
+    void OnGameObjectAddWorld(GameObject* go) override
+    {
+        TRIGGER_GAMEOBJECT_HOOK(ON_ADD_WORLD, go->GetEntry(), go);
+    }
+
+    /**
+     * @brief This hook runs after removing a GameObject from the world
+     *
+     * @param go Contains information about the GameObject
+     */
+    void OnGameObjectRemoveWorld(GameObject* go) override
+    {
+        TRIGGER_GAMEOBJECT_HOOK(ON_REMOVE_WORLD, go->GetEntry(), go);
+
+        // GameObject may be deleted once out of the world, neuter its Python
+        // proxy and stop the coroutines started by its events
+        ProxyCache::Invalidate(go->GetGUID());
+        sPythonEngine->CancelCoroutines(go->GetGUID());
     }
 };
 
 void AddSC_PythonGameObjectScripts()
 {
     new PythonGameObjectScript();
+    new PythonAllGameObjectScript();
 }
@@ -26,8 +26,7 @@ public:
      */
     bool OnQuestAccept(Player* player, Item* item, Quest const* quest) override
     {
-        TRIGGER_ITEM_HOOK(ON_USE, item->GetEntry(), player, item, quest);
-        return false;
+        return TRIGGER_ITEM_PREDICATE(ON_QUEST_ACCEPT, item->GetEntry(), false, player, item, quest);
     }
 
     /**
@@ -40,8 +39,7 @@ public:
      */
     bool OnUse(Player* player, Item* item, SpellCastTargets const& targets) override
     {
-        TRIGGER_ITEM_HOOK(ON_USE, item->GetEntry(), player, item, targets);
-        return false;
+        return TRIGGER_ITEM_PREDICATE(ON_USE, item->GetEntry(), false, player, item, targets);
     }
 
     /**
@@ -53,8 +51,7 @@ public:
      */
     bool OnRemove(Player* player, Item* item) override
     {
-        TRIGGER_ITEM_HOOK(ON_USE, item->GetEntry(), player, item);
-        return false;
+        return TRIGGER_ITEM_PREDICATE(ON_REMOVE, item->GetEntry(), false, player, item);
     }
 
     /**
@@ -69,8 +66,7 @@ public:
      */
     bool OnCastItemCombatSpell(Player* player, Unit* victim, SpellInfo const* spellInfo, Item* item) override
     {
-        TRIGGER_ITEM_HOOK(ON_USE, item->GetEntry(), player, victim, spellInfo, item);
-        return true;
+        return TRIGGER_ITEM_PREDICATE(ON_CAST_COMBAT_SPELL, item->GetEntry(), true, player, victim, spellInfo, item);
     }
 
     /**
@@ -82,8 +78,7 @@ public:
      */
     bool OnExpire(Player* player, ItemTemplate const* proto) override
     {
-        TRIGGER_ITEM_HOOK(ON_USE, proto->ItemId, player, proto);
-        return false;
+        return TRIGGER_ITEM_PREDICATE(ON_EXPIRE, proto->ItemId, false, player, proto);
     }
 
     /**
@@ -96,7 +91,7 @@ public:
      */
     void OnGossipSelect(Player* player, Item* item, uint32 sender, uint32 action) override
     {
-        TRIGGER_ITEM_HOOK(ON_USE, item->GetEntry(), player, item, sender, action);
+        TRIGGER_ITEM_HOOK(ON_GOSSIPE_SELECT, item->GetEntry(), player, item, sender, action);
     }
 
     /**
@@ -110,7 +105,7 @@ public:
      */
     void OnGossipSelectCode(Player* player, Item* item, uint32 sender, uint32 action, char const* code) override
     {
-        TRIGGER_ITEM_HOOK(ON_USE, item->GetEntry(), player, item, sender, action, code);
+        TRIGGER_ITEM_HOOK(ON_GOSSIPE_SELECT_CODE, item->GetEntry(), player, item, sender, action, code);
     }
 };
 
@@ -1,11 +1,15 @@
 #include "HookMacros.h"
+#include "ScriptHookGate.h"
 #include "ScriptMgr.h"
 #include "Player.h"
+#include "Spell.h"
 
 class PythonPlayerScript : public PlayerScript
 {
 public:
-    PythonPlayerScript() : PlayerScript("PythonPlayerScript") {}
+    // Only logout is always enabled (proxy invalidation, coroutine cancellation),
+    // the other hooks are enabled by the gate while Python subscribes to them
+    PythonPlayerScript() : PlayerScript("PythonPlayerScript", {PLAYERHOOK_ON_LOGOUT}) {}
 
     /**
      * @brief Called when a player logs in
@@ -25,6 +29,22 @@ public:
     void OnPlayerLogout(Player* player) override
     {
         TRIGGER_PLAYER_HOOK(ON_LOGOUT, player);
+
+        // Player object is deleted after logout, neuter its Python proxy and
+        // stop the coroutines started by its events
+        ProxyCache::Invalidate(player->GetGUID());
+        sPythonEngine->CancelCoroutines(player->GetGUID());
+    }
+
+    /**
+     * @brief Called on every update of a player
+     *
+     * @param player Contains information about the Player
+     * @param diff Contains information about the time since the last update in milliseconds
+     */
+    void OnPlayerUpdate(Player* player, uint32 diff) override
+    {
+        TRIGGER_PLAYER_HOOK(ON_UPDATE, player, diff);
     }
 
     /**
@@ -73,6 +93,19 @@ public:
         TRIGGER_PLAYER_HOOK(ON_MONEY_CHANGED, player, amount);
     }
 
+    /**
+     * @brief Called when a player casts a spell
+     *
+     * @param player Contains information about the Player
+     * @param spell Contains information about the Spell being cast
+     * @param skipCheck Contains information about whether the cast checks are skipped
+     */
+    void OnPlayerSpellCast(Player* player, Spell* spell, bool skipCheck) override
+    {
+        TRIGGER_PLAYER_SPELL_HOOK(ON_SPELL_CAST, spell->GetSpellInfo()->Id, player, spell->GetSpellInfo(),
+                                  &spell->m_targets, skipCheck);
+    }
+
     /**
      * @brief After looting an item
      *
@@ -85,9 +118,56 @@ public:
     {
         TRIGGER_PLAYER_HOOK(ON_LOOT_ITEM, player, item, count, lootguid);
     }
+
+    /**
+     * @brief Called when a player tries to equip an item
+     *
+     * @param player Contains information about the Player
+     * @param slot Contains information about the equipment slot
+     * @param dest Contains information about the destination position
+     * @param item Contains information about the Item
+     * @param swap Contains information about whether the item is swapped
+     * @param notLoading Contains information about whether the call is not from inventory loading
+     * @return True if the item can be equipped, false to prevent it
+     */
+    bool OnPlayerCanEquipItem(Player* player, uint8 slot, uint16& dest, Item* item, bool swap, bool notLoading) override
+    {
+        return TRIGGER_PLAYER_PREDICATE(CAN_EQUIP_ITEM, true, player, slot, dest, item, swap, notLoading);
+    }
+
+    // Other overloads (private, group, guild, channel) are separate hooks
+    using PlayerScript::OnPlayerCanUseChat;
+
+    /**
+     * @brief Called when a player sends a say, yell or emote chat message
+     *
+     * @param player Contains information about the Player
+     * @param type Contains information about the chat message type
+     * @param language Contains information about the language
+     * @param msg Contains information about the message
+     * @return True if the message can be sent, false to prevent it
+     */
+    bool OnPlayerCanUseChat(Player* player, uint32 type, uint32 language, std::string& msg) override
+    {
+        return TRIGGER_PLAYER_PREDICATE(CAN_PLAYER_USE_CHAT, true, player, type, language, msg);
+    }
 };
 
 void AddSC_PythonPlayerScripts()
 {
-    new PythonPlayerScript();
+    namespace Hooks = PyEng::Hooks::Player;
+    using Gate = PyEng::Scripts::ScriptHookGate<PlayerScript>;
+
+    Gate::Register(new PythonPlayerScript(), {
+        {Hooks::ON_LOGIN, PLAYERHOOK_ON_LOGIN},
+        {Hooks::ON_PVP_KILL, PLAYERHOOK_ON_PVP_KILL},
+        {Hooks::ON_UPDATE, PLAYERHOOK_ON_UPDATE},
+        {Hooks::ON_GIVE_EXP, PLAYERHOOK_ON_GIVE_EXP},
+        {Hooks::ON_LEVEL_CHANGED, PLAYERHOOK_ON_LEVEL_CHANGED},
+        {Hooks::ON_MONEY_CHANGED, PLAYERHOOK_ON_MONEY_CHANGED},
+        {Hooks::ON_LOOT_ITEM, PLAYERHOOK_ON_LOOT_ITEM},
+        {Hooks::ON_SPELL_CAST, PLAYERHOOK_ON_SPELL_CAST},
+        {Hooks::CAN_EQUIP_ITEM, PLAYERHOOK_CAN_EQUIP_ITEM},
+        {Hooks::CAN_PLAYER_USE_CHAT, PLAYERHOOK_CAN_PLAYER_USE_CHAT},
+    });
 }
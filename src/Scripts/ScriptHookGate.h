@@ -0,0 +1,119 @@
+#ifndef MOD_PYTHON_ENGINE_SCRIPT_HOOK_GATE_H
+#define MOD_PYTHON_ENGINE_SCRIPT_HOOK_GATE_H
+
+#include "HookSubscribers.h"
+#include "ScriptMgr.h"
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace PyEng::Scripts
+{
+    /**
+     * @brief Registry of script hook gates, refreshed from the world update
+     *
+     * ScriptRegistry<T>::EnabledHooks is read concurrently by map threads and
+     * is only safe to edit while no map is updating, so changes in the Python subscriptions (load, reload, runtime
+     * Register) are applied on the next world tick.
+     */
+    class ScriptHookGates
+    {
+    public:
+        /**
+         * @brief Adds a gate refresh function (at script registration)
+         */
+        static void Add(std::function<void()> refresh)
+        {
+            gates.push_back(std::move(refresh));
+        }
+
+        /**
+         * @brief Re-applies all gates if subscriptions changed (world thread)
+         */
+        static void Refresh()
+        {
+            uint32 generation = PyEng::Hooks::HookSubscribers::Generation();
+            if (generation == appliedGeneration)
+                return;
+
+            appliedGeneration = generation;
+            for (auto const& refresh : gates)
+                refresh();
+        }
+
+    private:
+        ScriptHookGates() = delete;
+
+        inline static std::vector<std::function<void()>> gates;
+        inline static uint32 appliedGeneration = 0;
+    };
+
+    /**
+     * @brief Enables core hooks of a script only while Python subscribes
+     *
+     * The script is constructed with its always-needed core hooks only; bound
+     * hooks are added to / removed from the ScriptMgr enabled-hook lists
+     * following the subscriber bitset, so ScriptMgr does not even make the
+     * virtual call for hooks nobody listens to.
+     *
+     * @tparam TScript Core script type with an enabled-hooks list (PlayerScript)
+     */
+    template<typename TScript>
+    class ScriptHookGate
+    {
+    public:
+        /**
+         * @brief Python hook -> core hook id (ex., PLAYERHOOK_ON_LOGIN)
+         */
+        struct Binding
+        {
+            PyEng::Hooks::HookInfo hook;
+            uint16 coreHook;
+        };
+
+        /**
+         * @brief Gates the bound core hooks of the script
+         *
+         * The script must be constructed with a non-empty hook list, as an
+         * empty one enables every hook. Start with one bound hook: the gate
+         * drops it right away unless Python subscribes.
+         *
+         * @param script Script instance registered with ScriptMgr
+         * @param bindings Core hooks enabled only while subscribed
+         */
+        static void Register(TScript* script, std::vector<Binding> bindings)
+        {
+            // Maps are not running yet at script registration
+            Apply(script, bindings);
+
+            ScriptHookGates::Add([script, bindings = std::move(bindings)] { Apply(script, bindings); });
+        }
+
+    private:
+        ScriptHookGate() = delete;
+
+        static void Apply(TScript* script, std::vector<Binding> const& bindings)
+        {
+            auto& enabledHooks = ScriptRegistry<TScript>::EnabledHooks;
+
+            for (Binding const& binding : bindings)
+            {
+                if (binding.coreHook >= enabledHooks.size())
+                    continue;
+
+                auto& scripts = enabledHooks[binding.coreHook];
+                auto itr = std::find(scripts.begin(), scripts.end(), script);
+                bool subscribed = PyEng::Hooks::HookSubscribers::Test(binding.hook);
+
+                if (subscribed && itr == scripts.end())
+                    scripts.push_back(script);
+                else if (!subscribed && itr != scripts.end())
+                    scripts.erase(itr);
+            }
+        }
+    };
+
+} // namespace PyEng::Scripts
+
+#endif // MOD_PYTHON_ENGINE_SCRIPT_HOOK_GATE_H
@@ -0,0 +1,61 @@
+#include "HookMacros.h"
+#include "ScriptMgr.h"
+#include "WorldPacket.h"
+#include "WorldSession.h"
+
+namespace
+{
+    /**
+     * @brief Payload of the packet, without the opcode
+     */
+    PyEng::Utilities::BufferView PayloadOf(WorldPacket const& packet)
+    {
+        // contents() throws on empty packets
+        if (packet.empty())
+            return {};
+
+        return {packet.contents(), packet.size()};
+    }
+
+} // anonymous namespace
+
+class PythonServerScript : public ServerScript
+{
+public:
+    // Not gated: the packet hooks run on network threads, which keep reading
+    // the enabled-hook lists while the world updates. An opcode no script
+    // registered for is dropped by OpcodeFilter after one relaxed load
+    PythonServerScript()
+        : ServerScript("PythonServerScript", {SERVERHOOK_CAN_PACKET_SEND, SERVERHOOK_CAN_PACKET_RECEIVE}) {}
+
+    /**
+     * @brief Called when a packet is sent to a client (network thread)
+     *
+     * @param session Contains information about the WorldSession
+     * @param packet Contains information about the WorldPacket
+     * @return True if the packet can be sent, false to drop it
+     */
+    bool CanPacketSend(WorldSession* session, WorldPacket const& packet) override
+    {
+        return TRIGGER_PACKET_PREDICATE(CAN_PACKET_SEND, packet.GetOpcode(), session->GetPlayer(),
+                                        session->GetAccountId(), packet.GetOpcode(), PayloadOf(packet));
+    }
+
+    /**
+     * @brief Called when a packet is received from a client (network thread)
+     *
+     * @param session Contains information about the WorldSession
+     * @param packet Contains information about the WorldPacket
+     * @return True if the packet can be handled, false to drop it
+     */
+    bool CanPacketReceive(WorldSession* session, WorldPacket const& packet) override
+    {
+        return TRIGGER_PACKET_PREDICATE(CAN_PACKET_RECEIVE, packet.GetOpcode(), session->GetPlayer(),
+                                        session->GetAccountId(), packet.GetOpcode(), PayloadOf(packet));
+    }
+};
+
+void AddSC_PythonServerScripts()
+{
+    new PythonServerScript();
+}
@@ -0,0 +1,147 @@
+#include "HookMacros.h"
+#include "ScriptHookGate.h"
+#include "ScriptMgr.h"
+#include "SpellAuras.h"
+#include "SpellInfo.h"
+#include "Unit.h"
+
+class PythonUnitScript : public UnitScript
+{
+public:
+    PythonUnitScript() : UnitScript("PythonUnitScript", true, {UNITHOOK_ON_DAMAGE}) {}
+
+    /**
+     * @brief Called when a unit is healed
+     *
+     * @param healer Contains information about the healer Unit (may be null)
+     * @param receiver Contains information about the healed Unit
+     * @param gain Contains information about the amount healed
+     */
+    void OnHeal(Unit* healer, Unit* receiver, uint32& gain) override
+    {
+        TRIGGER_UNIT_HOOK(ON_HEAL, healer, receiver, gain);
+        BATCH_UNIT_HOOK(ON_HEAL, healer, receiver, gain, 0);
+    }
+
+    /**
+     * @brief Called when a unit deals damage to another unit
+     *
+     * @param attacker Contains information about the attacker Unit (may be null)
+     * @param victim Contains information about the victim Unit
+     * @param damage Contains information about the damage dealt
+     */
+    void OnDamage(Unit* attacker, Unit* victim, uint32& damage) override
+    {
+        TRIGGER_UNIT_HOOK(ON_DAMAGE, attacker, victim, damage);
+        BATCH_UNIT_HOOK(ON_DAMAGE, attacker, victim, damage, 0);
+    }
+
+    /**
+     * @brief Called when a periodic damage aura ticks
+     *
+     * @param target Contains information about the target Unit
+     * @param attacker Contains information about the caster Unit (may be null)
+     * @param damage Contains information about the tick damage
+     * @param spellInfo Contains information about the aura spell
+     */
+    void ModifyPeriodicDamageAurasTick(Unit* target, Unit* attacker, uint32& damage,
+                                       SpellInfo const* spellInfo) override
+    {
+        TRIGGER_UNIT_HOOK(MODIFY_PERIODIC_DAMAGE_AURAS_TICK, target, attacker, damage, spellInfo);
+        BATCH_UNIT_HOOK(MODIFY_PERIODIC_DAMAGE_AURAS_TICK, attacker, target, damage, spellInfo ? spellInfo->Id : 0);
+    }
+
+    /**
+     * @brief Called when melee damage is calculated
+     *
+     * @param target Contains information about the target Unit
+     * @param attacker Contains information about the attacker Unit
+     * @param damage Contains information about the melee damage
+     */
+    void ModifyMeleeDamage(Unit* target, Unit* attacker, uint32& damage) override
+    {
+        TRIGGER_UNIT_HOOK(MODIFY_MELEE_DAMAGE, target, attacker, damage);
+        BATCH_UNIT_HOOK(MODIFY_MELEE_DAMAGE, attacker, target, damage, 0);
+    }
+
+    /**
+     * @brief Called when spell damage taken is calculated
+     *
+     * @param target Contains information about the target Unit
+     * @param attacker Contains information about the caster Unit
+     * @param damage Contains information about the spell damage
+     * @param spellInfo Contains information about the damaging spell
+     */
+    void ModifySpellDamageTaken(Unit* target, Unit* attacker, int32& damage, SpellInfo const* spellInfo) override
+    {
+        TRIGGER_UNIT_HOOK(MODIFY_SPELL_DAMAGE_TAKEN, target, attacker, damage, spellInfo);
+        BATCH_UNIT_HOOK(MODIFY_SPELL_DAMAGE_TAKEN, attacker, target, damage, spellInfo ? spellInfo->Id : 0);
+    }
+
+    /**
+     * @brief Called when a heal received is calculated
+     *
+     * @param target Contains information about the healed Unit
+     * @param healer Contains information about the healer Unit
+     * @param heal Contains information about the heal amount
+     * @param spellInfo Contains information about the healing spell
+     */
+    void ModifyHealReceived(Unit* target, Unit* healer, uint32& heal, SpellInfo const* spellInfo) override
+    {
+        TRIGGER_UNIT_HOOK(MODIFY_HEAL_RECEIVED, target, healer, heal, spellInfo);
+        BATCH_UNIT_HOOK(MODIFY_HEAL_RECEIVED, healer, target, heal, spellInfo ? spellInfo->Id : 0);
+    }
+
+    /**
+     * @brief Called on every update of a unit
+     *
+     * @param unit Contains information about the Unit
+     * @param diff Contains information about the time since the last update in milliseconds
+     */
+    void OnUnitUpdate(Unit* unit, uint32 diff) override
+    {
+        TRIGGER_UNIT_HOOK(ON_UNIT_UPDATE, unit, diff);
+    }
+
+    /**
+     * @brief Called when an aura is applied to a unit
+     *
+     * @param unit Contains information about the Unit
+     * @param aura Contains information about the applied Aura
+     */
+    void OnAuraApply(Unit* unit, Aura* aura) override
+    {
+        TRIGGER_UNIT_SPELL_HOOK(ON_AURA_APPLY, aura->GetId(), unit, aura);
+    }
+
+    /**
+     * @brief Called when an aura is removed from a unit
+     *
+     * @param unit Contains information about the Unit
+     * @param aurApp Contains information about the removed AuraApplication
+     * @param mode Contains information about the removal reason (AuraRemoveMode)
+     */
+    void OnAuraRemove(Unit* unit, AuraApplication* aurApp, AuraRemoveMode mode) override
+    {
+        TRIGGER_UNIT_SPELL_HOOK(ON_AURA_REMOVE, aurApp->GetBase()->GetId(), unit, aurApp->GetBase(),
+                                static_cast<uint8>(mode));
+    }
+};
+
+void AddSC_PythonUnitScripts()
+{
+    namespace Hooks = PyEng::Hooks::Unit;
+    using Gate = PyEng::Scripts::ScriptHookGate<UnitScript>;
+
+    Gate::Register(new PythonUnitScript(), {
+        {Hooks::ON_HEAL, UNITHOOK_ON_HEAL},
+        {Hooks::ON_DAMAGE, UNITHOOK_ON_DAMAGE},
+        {Hooks::MODIFY_PERIODIC_DAMAGE_AURAS_TICK, UNITHOOK_MODIFY_PERIODIC_DAMAGE_AURAS_TICK},
+        {Hooks::MODIFY_MELEE_DAMAGE, UNITHOOK_MODIFY_MELEE_DAMAGE},
+        {Hooks::MODIFY_SPELL_DAMAGE_TAKEN, UNITHOOK_MODIFY_SPELL_DAMAGE_TAKEN},
+        {Hooks::MODIFY_HEAL_RECEIVED, UNITHOOK_MODIFY_HEAL_RECEIVED},
+        {Hooks::ON_UNIT_UPDATE, UNITHOOK_ON_UNIT_UPDATE},
+        {Hooks::ON_AURA_APPLY, UNITHOOK_ON_AURA_APPLY},
+        {Hooks::ON_AURA_REMOVE, UNITHOOK_ON_AURA_REMOVE},
+    });
+}
@@ -0,0 +1,23 @@
+#ifndef MOD_PYTHON_ENGINE_BUFFER_VIEW_H
+#define MOD_PYTHON_ENGINE_BUFFER_VIEW_H
+
+#include "Define.h"
+#include <cstddef>
+
+namespace PyEng::Utilities
+{
+    /**
+     * @brief Non-owning view of a byte buffer (ex., packet payload)
+     *
+     * Only valid during the dispatch: passed to Python as a read-only
+     * memoryview over a copy of the bytes, which scripts may keep.
+     */
+    struct BufferView
+    {
+        uint8 const* data = nullptr;
+        std::size_t size = 0;
+    };
+
+} // namespace PyEng::Utilities
+
+#endif // MOD_PYTHON_ENGINE_BUFFER_VIEW_H
@@ -0,0 +1,150 @@
+#ifndef MOD_PYTHON_ENGINE_MPSC_RING_H
+#define MOD_PYTHON_ENGINE_MPSC_RING_H
+
+#include "Define.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace PyEng::Utilities
+{
+    /**
+     * @brief Bounded lock-free multi-producer single-consumer queue
+     *
+     * Array of cells with a per-cell sequence number (Vyukov): producers
+     * claim a position with a single CAS and publish the cell by bumping its
+     * sequence, the consumer never contends with them. A full ring rejects
+     * the push instead of blocking or allocating.
+     *
+     * @tparam T Element type (constructed in place, destroyed after pop)
+     */
+    template<typename T>
+    class MpscRing
+    {
+    public:
+        /**
+         * @param capacity Requested size, rounded up to a power of two
+         */
+        explicit MpscRing(std::size_t capacity)
+        {
+            std::size_t size = 2;
+            while (size < capacity)
+                size <<= 1;
+
+            mask = size - 1;
+            cells = std::make_unique<Cell[]>(size);
+            for (std::size_t i = 0; i < size; ++i)
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        ~MpscRing()
+        {
+            while (TryPop([](T&) {}))
+                ;
+        }
+
+        MpscRing(MpscRing const&) = delete;
+        MpscRing& operator=(MpscRing const&) = delete;
+
+        /**
+         * @brief Constructs an element at the tail (any thread)
+         *
+         * @return False if the ring is full
+         */
+        template<typename... CtorArgs>
+        bool TryPush(CtorArgs&&... args)
+        {
+            std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+            Cell* cell;
+
+            for (;;)
+            {
+                cell = &cells[pos & mask];
+                std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                    return false;
+                else
+                    pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+
+            new (cell->storage) T(std::forward<CtorArgs>(args)...);
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Hands the head element to the consumer and destroys it
+         *
+         * Must only be called from one thread at a time.
+         *
+         * @param consumer Callable taking T&
+         * @return False if the ring is empty
+         */
+        template<typename Consumer>
+        bool TryPop(Consumer&& consumer)
+        {
+            Cell& cell = cells[dequeuePos & mask];
+            if (cell.sequence.load(std::memory_order_acquire) != dequeuePos + 1)
+                return false;
+
+            T* element = std::launder(reinterpret_cast<T*>(cell.storage));
+
+            // Cell is released even if the consumer throws
+            struct Release
+            {
+                ~Release()
+                {
+                    element->~T();
+                    cell.sequence.store(pos + mask + 1, std::memory_order_release);
+                }
+
+                T* element;
+                Cell& cell;
+                std::size_t pos;
+                std::size_t mask;
+            } release{element, cell, dequeuePos, mask};
+
+            ++dequeuePos;
+            consumer(*element);
+            return true;
+        }
+
+        /**
+         * @brief Checks for a published head element (consumer thread)
+         */
+        [[nodiscard]] bool Empty() const noexcept
+        {
+            return cells[dequeuePos & mask].sequence.load(std::memory_order_acquire) != dequeuePos + 1;
+        }
+
+        [[nodiscard]] std::size_t Capacity() const noexcept { return mask + 1; }
+
+    private:
+        struct Cell
+        {
+            std::atomic<std::size_t> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        static constexpr std::size_t CACHE_LINE = 64;
+
+        std::unique_ptr<Cell[]> cells;
+        std::size_t mask = 0;
+
+        // Producer and consumer positions live on separate cache lines
+        alignas(CACHE_LINE) std::atomic<std::size_t> enqueuePos{0};
+        alignas(CACHE_LINE) std::size_t dequeuePos = 0;
+    };
+
+} // namespace PyEng::Utilities
+
+#endif // MOD_PYTHON_ENGINE_MPSC_RING_H
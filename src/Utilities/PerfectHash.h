@@ -0,0 +1,193 @@
+#ifndef MOD_PYTHON_ENGINE_PERFECT_HASH_H
+#define MOD_PYTHON_ENGINE_PERFECT_HASH_H
+
+#include "Define.h"
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+
+namespace PyEng::Utilities
+{
+    /**
+     * @brief Compile-time minimal-probe perfect hash over a fixed string set
+     *
+     * Hash-and-displace construction: keys are split into buckets by a base
+     * hash, then every bucket (largest first) searches a displacement that
+     * moves all its keys to free slots. A lookup costs one string hash, one
+     * remix and a single key comparison; no heap and no static initializer.
+     *
+     * @tparam KeyCount Number of keys (must be distinct)
+     */
+    template<std::size_t KeyCount>
+    class PerfectHash
+    {
+    public:
+        static_assert(KeyCount > 0 && KeyCount < std::numeric_limits<uint16>::max(), "Key count out of range");
+
+        static constexpr std::size_t BUCKET_COUNT = (KeyCount + 1) / 2;
+        static constexpr std::size_t SLOT_COUNT = [] {
+            std::size_t count = 1;
+            while (count < KeyCount * 2)
+                count <<= 1;
+            return count;
+        }();
+
+        using Keys = std::array<std::string_view, KeyCount>;
+
+        /**
+         * @brief Base string hash (FNV-style, 8 bytes per step)
+         */
+        static constexpr uint64 Hash(std::string_view key) noexcept
+        {
+            uint64 hash = 14695981039346656037ull ^ key.size();
+            std::size_t pos = 0;
+
+            for (; pos + 8 <= key.size(); pos += 8)
+            {
+                hash = (hash ^ Load64(key, pos)) * 1099511628211ull;
+                hash ^= hash >> 29;
+            }
+
+            // Remaining bytes: the last 8 (overlapping) or a short key
+            uint64 tail = 0;
+            if (key.size() >= 8)
+                tail = pos < key.size() ? Load64(key, key.size() - 8) : 0;
+            else
+                for (std::size_t i = 0; i < key.size(); ++i)
+                    tail |= uint64(static_cast<uint8>(key[i])) << (i * 8);
+
+            hash = (hash ^ tail) * 1099511628211ull;
+            return hash ^ (hash >> 32);
+        }
+
+        /**
+         * @brief Builds the table (intended for constant evaluation)
+         *
+         * @param keys Distinct keys
+         * @return Table; Valid() is false if construction failed
+         */
+        static constexpr PerfectHash Build(Keys const& keys)
+        {
+            PerfectHash table;
+
+            // Counting sort of key indices by bucket
+            std::array<uint64, KeyCount> hashes{};
+            std::array<std::size_t, BUCKET_COUNT + 1> bucketStart{};
+            for (std::size_t i = 0; i < KeyCount; ++i)
+            {
+                hashes[i] = Hash(keys[i]);
+                ++bucketStart[hashes[i] % BUCKET_COUNT + 1];
+            }
+
+            for (std::size_t b = 0; b < BUCKET_COUNT; ++b)
+                bucketStart[b + 1] += bucketStart[b];
+
+            std::array<uint16, KeyCount> bucketKeys{};
+            std::array<std::size_t, BUCKET_COUNT> fill{};
+            for (std::size_t i = 0; i < KeyCount; ++i)
+            {
+                std::size_t bucket = hashes[i] % BUCKET_COUNT;
+                bucketKeys[bucketStart[bucket] + fill[bucket]++] = static_cast<uint16>(i);
+            }
+
+            // Largest buckets are placed first, while the table is empty
+            std::array<std::size_t, BUCKET_COUNT> order{};
+            for (std::size_t b = 0; b < BUCKET_COUNT; ++b)
+                order[b] = b;
+
+            for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+            {
+                std::size_t largest = i;
+                for (std::size_t j = i + 1; j < BUCKET_COUNT; ++j)
+                    if (fill[order[j]] > fill[order[largest]])
+                        largest = j;
+
+                std::size_t swap = order[i];
+                order[i] = order[largest];
+                order[largest] = swap;
+            }
+
+            for (std::size_t bucket : order)
+            {
+                if (!fill[bucket])
+                    break;
+
+                bool placed = false;
+                for (uint32 seed = 0; seed < std::numeric_limits<uint16>::max() && !placed; ++seed)
+                {
+                    placed = true;
+                    for (std::size_t k = bucketStart[bucket]; k < bucketStart[bucket + 1] && placed; ++k)
+                    {
+                        std::size_t slot = Slot(hashes[bucketKeys[k]], seed);
+                        if (table.slots[slot])
+                            placed = false;
+
+                        // Keys of the same bucket must not collide either
+                        for (std::size_t other = bucketStart[bucket]; other < k && placed; ++other)
+                            if (Slot(hashes[bucketKeys[other]], seed) == slot)
+                                placed = false;
+                    }
+
+                    if (placed)
+                    {
+                        table.displacement[bucket] = static_cast<uint16>(seed);
+                        for (std::size_t k = bucketStart[bucket]; k < bucketStart[bucket + 1]; ++k)
+                            table.slots[Slot(hashes[bucketKeys[k]], seed)] = static_cast<uint16>(bucketKeys[k] + 1);
+                    }
+                }
+
+                if (!placed)
+                    return PerfectHash();
+            }
+
+            table.valid = true;
+            return table;
+        }
+
+        /**
+         * @brief Finds the index of the key
+         *
+         * @param keys Key set the table was built from
+         * @param key Key to look up
+         * @return Key index, or KeyCount if not found
+         */
+        constexpr std::size_t Find(Keys const& keys, std::string_view key) const noexcept
+        {
+            uint64 hash = Hash(key);
+            uint16 index = slots[Slot(hash, displacement[hash % BUCKET_COUNT])];
+            return index && keys[index - 1] == key ? index - 1 : KeyCount;
+        }
+
+        [[nodiscard]] constexpr bool Valid() const noexcept { return valid; }
+
+    private:
+        constexpr PerfectHash() = default;
+
+        // Little-endian 8 byte read, spelled out so compilers merge it into a
+        // single load outside of constant evaluation
+        static constexpr uint64 Load64(std::string_view key, std::size_t pos) noexcept
+        {
+            return uint64(static_cast<uint8>(key[pos])) | uint64(static_cast<uint8>(key[pos + 1])) << 8 |
+                   uint64(static_cast<uint8>(key[pos + 2])) << 16 | uint64(static_cast<uint8>(key[pos + 3])) << 24 |
+                   uint64(static_cast<uint8>(key[pos + 4])) << 32 | uint64(static_cast<uint8>(key[pos + 5])) << 40 |
+                   uint64(static_cast<uint8>(key[pos + 6])) << 48 | uint64(static_cast<uint8>(key[pos + 7])) << 56;
+        }
+
+        // Remixes the base hash with the bucket displacement (splitmix64)
+        static constexpr std::size_t Slot(uint64 hash, uint32 seed) noexcept
+        {
+            uint64 x = hash + (uint64(seed) + 1) * 0x9E3779B97F4A7C15ull;
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+            return static_cast<std::size_t>((x ^ (x >> 31)) & (SLOT_COUNT - 1));
+        }
+
+        std::array<uint16, BUCKET_COUNT> displacement{};
+        std::array<uint16, SLOT_COUNT> slots{}; // key index + 1, 0 = empty
+        bool valid = false;
+    };
+
+} // namespace PyEng::Utilities
+
+#endif // MOD_PYTHON_ENGINE_PERFECT_HASH_H
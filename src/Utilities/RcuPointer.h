@@ -0,0 +1,223 @@
+#ifndef MOD_PYTHON_ENGINE_RCU_POINTER_H
+#define MOD_PYTHON_ENGINE_RCU_POINTER_H
+
+#include "Define.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace PyEng::Utilities
+{
+    /**
+     * @brief Process-wide epoch registry for lock-free readers
+     *
+     * Each reader thread owns a cache-line sized record where it announces the
+     * epoch it entered its read section with. Readers never write shared
+     * memory, so concurrent readers don't contend on a common cache line.
+     * Writers advance the global epoch and scan the records to find the oldest
+     * epoch that may still be observed.
+     */
+    class EpochDomain
+    {
+    public:
+        /**
+         * @brief Enter read section (nesting is allowed on the same thread)
+         */
+        static void Enter() noexcept
+        {
+            Record* record = LocalRecord();
+            if (record->nesting++ == 0)
+                record->epoch.store(globalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        }
+
+        /**
+         * @brief Leave read section
+         */
+        static void Leave() noexcept
+        {
+            Record* record = LocalRecord();
+            if (--record->nesting == 0)
+                record->epoch.store(INACTIVE, std::memory_order_release);
+        }
+
+        /**
+         * @brief Close the current epoch (writer side)
+         *
+         * @return Closed epoch; objects retired with it are safe to destroy once
+         *         OldestActive() is greater than this value
+         */
+        static uint64 Advance() noexcept
+        {
+            return globalEpoch.fetch_add(1, std::memory_order_seq_cst);
+        }
+
+        /**
+         * @brief Oldest epoch still announced by a reader
+         *
+         * @return Oldest active epoch, or max uint64 if no reader is active
+         */
+        [[nodiscard]] static uint64 OldestActive() noexcept
+        {
+            uint64 oldest = std::numeric_limits<uint64>::max();
+            for (Record* record = head.load(std::memory_order_acquire); record; record = record->next)
+            {
+                uint64 epoch = record->epoch.load(std::memory_order_seq_cst);
+                if (epoch != INACTIVE)
+                    oldest = std::min(oldest, epoch);
+            }
+
+            return oldest;
+        }
+
+    private:
+        EpochDomain() = delete;
+
+        static constexpr uint64 INACTIVE = 0;
+
+        struct alignas(64) Record
+        {
+            std::atomic<uint64> epoch{INACTIVE};
+            std::atomic<bool> inUse{true};
+            uint32 nesting = 0; // owner thread only
+            Record* next = nullptr;
+        };
+
+        // Releases the record for reuse when the owner thread exits
+        struct LocalHandle
+        {
+            LocalHandle() : record(Acquire()) {}
+            ~LocalHandle() { record->inUse.store(false, std::memory_order_release); }
+
+            Record* record;
+        };
+
+        static Record* LocalRecord() noexcept
+        {
+            thread_local LocalHandle handle;
+            return handle.record;
+        }
+
+        static Record* Acquire()
+        {
+            // Reuse a record released by an exited thread
+            for (Record* record = head.load(std::memory_order_acquire); record; record = record->next)
+            {
+                bool expected = false;
+                if (record->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                    return record;
+            }
+
+            // Records are never freed, lock-free push to the list head
+            Record* record = new Record();
+            record->next = head.load(std::memory_order_relaxed);
+            while (!head.compare_exchange_weak(record->next, record, std::memory_order_release,
+                                               std::memory_order_relaxed))
+                ;
+
+            return record;
+        }
+
+        inline static std::atomic<uint64> globalEpoch{1};
+        inline static std::atomic<Record*> head{nullptr};
+    };
+
+    /**
+     * @brief Read-copy-update pointer to an immutable object
+     *
+     * Readers load the current object inside a ReadGuard without any locking.
+     * Writers publish a replacement with an atomic swap; the previous object is
+     * retired and only destroyed after every reader that could have observed
+     * it has left its read section.
+     *
+     * @note Publish() and CollectRetired() must be serialized by the caller.
+     *
+     * @tparam T Published object type
+     */
+    template<typename T>
+    class RcuPointer
+    {
+    public:
+        /**
+         * @brief RAII read section pinning the current object
+         */
+        class ReadGuard
+        {
+        public:
+            explicit ReadGuard(RcuPointer const& pointer) noexcept
+            {
+                EpochDomain::Enter();
+                value = pointer.current.load(std::memory_order_seq_cst);
+            }
+
+            ~ReadGuard() { EpochDomain::Leave(); }
+
+            ReadGuard(ReadGuard const&) = delete;
+            ReadGuard& operator=(ReadGuard const&) = delete;
+
+            [[nodiscard]] T const* Get() const noexcept { return value; }
+            T const* operator->() const noexcept { return value; }
+            explicit operator bool() const noexcept { return value != nullptr; }
+
+        private:
+            T const* value;
+        };
+
+        RcuPointer() = default;
+        ~RcuPointer() { delete current.load(std::memory_order_relaxed); }
+
+        RcuPointer(RcuPointer const&) = delete;
+        RcuPointer& operator=(RcuPointer const&) = delete;
+
+        /**
+         * @brief Replace the published object and retire the previous one
+         *
+         * @param next New immutable object (may be nullptr)
+         */
+        void Publish(std::unique_ptr<T> next)
+        {
+            T* previous = current.exchange(next.release(), std::memory_order_seq_cst);
+            if (previous)
+                retired.emplace_back(EpochDomain::Advance(), std::unique_ptr<T>(previous));
+        }
+
+        /**
+         * @brief Extract retired objects no reader can observe anymore
+         *
+         * Ownership is handed to the caller, so objects can be destroyed
+         * outside of any writer lock.
+         *
+         * @return Objects safe to destroy
+         */
+        [[nodiscard]] std::vector<std::unique_ptr<T>> CollectRetired()
+        {
+            std::vector<std::unique_ptr<T>> expired;
+            if (retired.empty())
+                return expired;
+
+            uint64 oldest = EpochDomain::OldestActive();
+            auto itr = std::stable_partition(retired.begin(), retired.end(),
+                                             [oldest](auto const& item) { return item.first >= oldest; });
+
+            for (auto it = itr; it != retired.end(); ++it)
+                expired.push_back(std::move(it->second));
+
+            retired.erase(itr, retired.end());
+            return expired;
+        }
+
+        /**
+         * @brief Number of retired objects waiting for readers
+         */
+        [[nodiscard]] std::size_t RetiredCount() const noexcept { return retired.size(); }
+
+    private:
+        std::atomic<T*> current{nullptr};
+        std::vector<std::pair<uint64, std::unique_ptr<T>>> retired;
+    };
+
+} // namespace PyEng::Utilities
+
+#endif // MOD_PYTHON_ENGINE_RCU_POINTER_H
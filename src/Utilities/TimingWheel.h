@@ -0,0 +1,342 @@
+#ifndef MOD_PYTHON_ENGINE_TIMING_WHEEL_H
+#define MOD_PYTHON_ENGINE_TIMING_WHEEL_H
+
+#include "Define.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace PyEng::Utilities
+{
+    /**
+     * @brief Hierarchical timing wheel with millisecond resolution
+     *
+     * Four levels of 256 slots cover every uint32 delay: a timer is linked
+     * into the level matching its remaining time and moved one level down
+     * whenever the slot of the level above comes around (cascade), so insert
+     * and cancel are O(1) and advancing costs one slot per elapsed
+     * millisecond plus the cascaded timers. Timers live in a node array
+     * with intrusive doubly linked slot lists (FIFO); handles carry the node
+     * generation, so a stale handle never reaches a reused node.
+     *
+     * Not thread-safe. Due timers are reported by Advance() and stay
+     * allocated until Fire() or Cancel(), so a callback can still cancel a
+     * timer that expired on the same tick.
+     *
+     * @tparam T Payload type (default constructible, copyable for repeating timers)
+     */
+    template<typename T>
+    class TimingWheel
+    {
+    public:
+        using Handle = uint64; // 0 is never a valid handle
+
+        /**
+         * @brief Arms a timer
+         *
+         * @param delay Time until expiration in milliseconds (at least 1)
+         * @param period Re-arm delay of a repeating timer in milliseconds, 0 for one-shot
+         * @param value Payload returned by Fire() and Cancel()
+         * @return Timer handle
+         */
+        Handle Schedule(uint32 delay, uint32 period, T value)
+        {
+            uint32 index = Allocate();
+            Node& node = nodes[index];
+            node.value = std::move(value);
+            node.period = period;
+            node.expires = current + (delay ? delay : 1);
+
+            Link(index);
+            return MakeHandle(index, node.generation);
+        }
+
+        /**
+         * @brief Disarms a timer, whether pending or expired and not fired yet
+         *
+         * @return Payload of the timer, or nullopt if the handle is stale
+         */
+        std::optional<T> Cancel(Handle handle)
+        {
+            Node* node = Find(handle);
+            if (!node)
+                return std::nullopt;
+
+            if (node->state == State::Armed)
+                Unlink(static_cast<uint32>(handle));
+
+            return Release(static_cast<uint32>(handle));
+        }
+
+        /**
+         * @brief Disarms all timers whose payload matches
+         *
+         * @param predicate bool(T const&)
+         * @param removed [out] Payloads of the disarmed timers
+         */
+        template<typename Predicate>
+        void CancelIf(Predicate&& predicate, std::vector<T>& removed)
+        {
+            for (uint32 index = 0; index < nodes.size(); ++index)
+            {
+                Node& node = nodes[index];
+                if (node.state == State::Free || !predicate(*node.value))
+                    continue;
+
+                if (node.state == State::Armed)
+                    Unlink(index);
+
+                removed.push_back(*Release(index));
+            }
+        }
+
+        /**
+         * @brief Moves the wheel forward, reporting the timers that expired
+         *
+         * @param diff Elapsed time in milliseconds
+         * @param expired [out] Handles of the due timers, ordered by expiration time
+         */
+        void Advance(uint32 diff, std::vector<Handle>& expired)
+        {
+            while (diff > 0 && armed > 0)
+            {
+                // Without level 0 timers, only the next cascade can expire one
+                if (!linked[0])
+                {
+                    uint32 skip = std::min(diff, SLOT_COUNT - 1 - static_cast<uint32>(current & (SLOT_COUNT - 1)));
+                    current += skip;
+                    diff -= skip;
+                    if (!diff)
+                        break;
+                }
+
+                Step(expired);
+                --diff;
+            }
+
+            // Nothing is linked: the slots can be skipped at once
+            current += diff;
+        }
+
+        /**
+         * @brief Takes the payload of an expired timer
+         *
+         * One-shot timers are released. Repeating timers are re-armed one
+         * period after their expiration (no drift) and keep their handle.
+         *
+         * @return Payload (a copy for repeating timers), or nullopt if the timer was cancelled
+         */
+        std::optional<T> Fire(Handle handle)
+        {
+            Node* node = Find(handle);
+            if (!node || node->state != State::Expired)
+                return std::nullopt;
+
+            uint32 index = static_cast<uint32>(handle);
+            if (!node->period)
+                return Release(index);
+
+            node->expires = std::max(node->expires + node->period, current + 1);
+            Link(index);
+            return node->value;
+        }
+
+        /**
+         * @brief Number of timers not released yet (pending or expired)
+         */
+        [[nodiscard]] std::size_t Size() const noexcept { return nodes.size() - freeCount; }
+
+    private:
+        static constexpr uint32 SLOT_BITS = 8;
+        static constexpr uint32 SLOT_COUNT = 1u << SLOT_BITS;
+        static constexpr uint32 LEVELS = 4; // 4 * 8 bits: any uint32 delay
+        static constexpr uint32 NIL = ~uint32(0);
+
+        enum class State : uint8
+        {
+            Free,
+            Armed,   // linked into a slot
+            Expired, // reported by Advance(), waiting for Fire()
+        };
+
+        struct Node
+        {
+            std::optional<T> value;
+            uint64 expires = 0;
+            uint32 period = 0;
+            uint32 generation = 1;
+            uint32 slot = NIL; // heads/tails index while armed
+            uint32 prev = NIL;
+            uint32 next = NIL; // also links the free list
+            State state = State::Free;
+        };
+
+        static Handle MakeHandle(uint32 index, uint32 generation) noexcept
+        {
+            return (static_cast<uint64>(generation) << 32) | index;
+        }
+
+        Node* Find(Handle handle) noexcept
+        {
+            uint32 index = static_cast<uint32>(handle);
+            if (index >= nodes.size())
+                return nullptr;
+
+            Node& node = nodes[index];
+            if (node.state == State::Free || node.generation != static_cast<uint32>(handle >> 32))
+                return nullptr;
+
+            return &node;
+        }
+
+        uint32 Allocate()
+        {
+            if (freeHead == NIL)
+            {
+                nodes.emplace_back();
+                return static_cast<uint32>(nodes.size() - 1);
+            }
+
+            uint32 index = freeHead;
+            freeHead = nodes[index].next;
+            --freeCount;
+            return index;
+        }
+
+        std::optional<T> Release(uint32 index)
+        {
+            Node& node = nodes[index];
+            std::optional<T> value = std::move(node.value);
+            node.value.reset();
+            node.state = State::Free;
+
+            // Skip 0 on wrap-around: handle 0 stays invalid
+            if (++node.generation == 0)
+                node.generation = 1;
+
+            node.next = freeHead;
+            freeHead = index;
+            ++freeCount;
+            return value;
+        }
+
+        void Link(uint32 index)
+        {
+            Node& node = nodes[index];
+
+            // Level from the remaining time: delta < 2^(8 * (level + 1)).
+            // Cascaded timers may be due now, they go to the current slot
+            uint64 delta = node.expires > current ? node.expires - current : 0;
+            uint32 level = 0;
+            while (level + 1 < LEVELS && delta >= (uint64(1) << (SLOT_BITS * (level + 1))))
+                ++level;
+
+            uint64 expires = delta ? node.expires : current;
+            uint32 slot = level * SLOT_COUNT + static_cast<uint32>((expires >> (SLOT_BITS * level)) & (SLOT_COUNT - 1));
+
+            // Appended: timers due the same millisecond expire in arming order
+            node.state = State::Armed;
+            node.slot = slot;
+            node.prev = tails[slot];
+            node.next = NIL;
+            if (node.prev != NIL)
+                nodes[node.prev].next = index;
+            else
+                heads[slot] = index;
+
+            tails[slot] = index;
+            ++linked[level];
+            ++armed;
+        }
+
+        void Unlink(uint32 index)
+        {
+            Node& node = nodes[index];
+
+            if (node.prev != NIL)
+                nodes[node.prev].next = node.next;
+            else
+                heads[node.slot] = node.next;
+
+            if (node.next != NIL)
+                nodes[node.next].prev = node.prev;
+            else
+                tails[node.slot] = node.prev;
+
+            --linked[node.slot / SLOT_COUNT];
+            --armed;
+            node.slot = node.prev = node.next = NIL;
+        }
+
+        // Detaches the whole list of a slot
+        uint32 TakeSlot(uint32 slot) noexcept
+        {
+            uint32 head = heads[slot];
+            heads[slot] = tails[slot] = NIL;
+            return head;
+        }
+
+        void Step(std::vector<Handle>& expired)
+        {
+            ++current;
+
+            // A slot of level N starts when the bits below it wrap to zero;
+            // its timers are relinked by remaining time (lower levels first)
+            for (uint32 level = 1; level < LEVELS; ++level)
+            {
+                uint32 shift = SLOT_BITS * level;
+                if (current & ((uint64(1) << shift) - 1))
+                    break;
+
+                uint32 slot = level * SLOT_COUNT + static_cast<uint32>((current >> shift) & (SLOT_COUNT - 1));
+                for (uint32 index = TakeSlot(slot); index != NIL;)
+                {
+                    uint32 next = nodes[index].next;
+                    --linked[level];
+                    --armed;
+                    Link(index);
+                    index = next;
+                }
+            }
+
+            uint32 slot = static_cast<uint32>(current & (SLOT_COUNT - 1));
+            for (uint32 index = TakeSlot(slot); index != NIL;)
+            {
+                Node& node = nodes[index];
+                uint32 next = node.next;
+
+                node.state = State::Expired;
+                node.slot = node.prev = node.next = NIL;
+                --linked[0];
+                --armed;
+
+                expired.push_back(MakeHandle(index, node.generation));
+                index = next;
+            }
+        }
+
+        std::vector<Node> nodes;
+        std::array<uint32, LEVELS * SLOT_COUNT> heads = EmptySlots();
+        std::array<uint32, LEVELS * SLOT_COUNT> tails = EmptySlots();
+        uint32 freeHead = NIL;
+        std::size_t freeCount = 0;
+        std::array<std::size_t, LEVELS> linked{}; // armed timers per level
+        std::size_t armed = 0;
+        uint64 current = 0; // last processed millisecond
+
+        static constexpr std::array<uint32, LEVELS * SLOT_COUNT> EmptySlots() noexcept
+        {
+            std::array<uint32, LEVELS * SLOT_COUNT> empty{};
+            for (uint32& head : empty)
+                head = NIL;
+
+            return empty;
+        }
+    };
+
+} // namespace PyEng::Utilities
+
+#endif // MOD_PYTHON_ENGINE_TIMING_WHEEL_H
@@ -0,0 +1,68 @@
+#include "PythonHeaders.h"
+#include "ObjectHandle.h"
+#include "gtest/gtest.h"
+
+namespace bp = boost::python;
+
+void InitAzerothCoreModule();
+
+namespace
+{
+    /**
+     * @brief Runs the embedded interpreter with the azerothcore module imported
+     */
+    class ObjectHandleTest : public ::testing::Test
+    {
+    protected:
+        static void SetUpTestSuite()
+        {
+            if (Py_IsInitialized())
+                return;
+
+            InitAzerothCoreModule();
+            Py_Initialize();
+            bp::import("azerothcore");
+        }
+
+        static bp::object MakeHandle(ObjectGuid guid, uint32 mapId = 0, uint32 instanceId = 0)
+        {
+            return bp::object(PyEng::ObjectHandle(PyEng::Hooks::DeferredObject{guid, mapId, instanceId}));
+        }
+
+        static bp::object Evaluate(char const* expression, bp::object const& locals)
+        {
+            return bp::eval(expression, bp::import("__main__").attr("__dict__"), locals);
+        }
+    };
+
+} // anonymous namespace
+
+TEST_F(ObjectHandleTest, HashMatchesGuid)
+{
+    ObjectGuid guid(HighGuid::Player, 0, 42);
+
+    bp::object handle = MakeHandle(guid);
+
+    EXPECT_EQ(PyObject_Hash(handle.ptr()), PyObject_Hash(bp::object(guid.GetRawValue()).ptr()));
+}
+
+TEST_F(ObjectHandleTest, EqualHandlesCollapseInSet)
+{
+    bp::dict locals;
+    locals["a"] = MakeHandle(ObjectGuid(HighGuid::Player, 0, 42));
+    locals["b"] = MakeHandle(ObjectGuid(HighGuid::Player, 0, 42), 1, 3); // same GUID, other map
+    locals["c"] = MakeHandle(ObjectGuid(HighGuid::Unit, 1234, 42));
+
+    EXPECT_TRUE(bp::extract<bool>(Evaluate("a == b", locals)));
+    EXPECT_EQ(bp::extract<int>(Evaluate("len({a, b})", locals))(), 1);
+    EXPECT_EQ(bp::extract<int>(Evaluate("len({a, b, c})", locals))(), 2);
+}
+
+TEST_F(ObjectHandleTest, EqualHandlesShareDictKey)
+{
+    bp::dict locals;
+    locals["a"] = MakeHandle(ObjectGuid(HighGuid::Player, 0, 42));
+    locals["b"] = MakeHandle(ObjectGuid(HighGuid::Player, 0, 42));
+
+    EXPECT_EQ(bp::extract<int>(Evaluate("{a: 1}[b]", locals))(), 1);
+}